@@ -28,6 +28,8 @@
 #include "oatpp/async/Error.hpp"
 #include "oatpp/Types.hpp"
 
+#include <type_traits>
+
 #if !defined(WIN32) && !defined(_WIN32)
 #include <sys/socket.h>
 #endif
@@ -72,6 +74,23 @@ bool isValidIOHandle(v_io_handle handle);
  */
 typedef v_int64 v_io_size;
 
+/**
+ * Convert offset to the file offset type of the platform API (ex.: `off_t`, `long`).
+ * Casts only if the types differ.
+ * @tparam T - file offset type.
+ * @param offset - offset.
+ * @return - offset of type `T`.
+ */
+template<typename T>
+typename std::enable_if<std::is_same<T, v_int64>::value, T>::type toFileOffset(v_int64 offset) {
+  return offset;
+}
+
+template<typename T>
+typename std::enable_if<!std::is_same<T, v_int64>::value, T>::type toFileOffset(v_int64 offset) {
+  return static_cast<T>(offset);
+}
+
 /**
  * Final set of possible I/O operation error values.
  * I/O operation should not return any other error values.
@@ -28,7 +28,8 @@
 
 #include "./Error.hpp"
 
-#include "oatpp/async/utils/FastQueue.hpp"
+#include "oatpp/async/utils/FrameAllocator.hpp"
+#include "oatpp/async/utils/MPSCQueue.hpp"
 
 #include "oatpp/IODefinitions.hpp"
 #include "oatpp/Environment.hpp"
@@ -414,6 +415,7 @@ public:
  */
 class CoroutineHandle : public oatpp::base::Countable {
   friend utils::FastQueue<CoroutineHandle>;
+  friend utils::MPSCQueue<CoroutineHandle>;
   friend Processor;
   friend worker::Worker;
   friend CoroutineWaitList;
@@ -427,6 +429,17 @@ private:
   FunctionPtr _FP; // Function pointer
   oatpp::async::Action _SCH_A; // Scheduled action
   CoroutineHandle* _ref; // pointer to next coroutine handle in list
+public:
+
+  static void* operator new(std::size_t sz) {
+    return utils::FrameAllocator::allocate(sz);
+  }
+
+  static void operator delete(void* ptr, std::size_t sz) {
+    (void)sz;
+    utils::FrameAllocator::deallocate(ptr);
+  }
+
 public:
 
   CoroutineHandle(Processor* processor, AbstractCoroutine* rootCoroutine);
@@ -598,12 +611,12 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return utils::FrameAllocator::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
     (void)sz;
-    ::operator delete(ptr);
+    utils::FrameAllocator::deallocate(ptr);
   }
 
 public:
@@ -754,12 +767,12 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return utils::FrameAllocator::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
     (void)sz;
-    ::operator delete(ptr);
+    utils::FrameAllocator::deallocate(ptr);
   }
 public:
 
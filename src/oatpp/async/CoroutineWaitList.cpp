@@ -59,8 +59,11 @@ void CoroutineWaitList::add(CoroutineHandle* coroutine) {
 
 void CoroutineWaitList::notifyFirst() {
   std::lock_guard<std::mutex> lock(m_lock);
-  if(!m_coroutines.empty()) {
-    removeCoroutine(*m_coroutines.begin());
+  /* skip coroutines which are already timed-out */
+  while(!m_coroutines.empty()) {
+    if(removeCoroutine(*m_coroutines.begin())) {
+      break;
+    }
   }
 }
 
@@ -71,9 +74,9 @@ void CoroutineWaitList::notifyAll() {
   }
 }
 
-void CoroutineWaitList::removeCoroutine(CoroutineHandle* coroutine) {
+bool CoroutineWaitList::removeCoroutine(CoroutineHandle* coroutine) {
   m_coroutines.erase(coroutine);
-  coroutine->_PP->wakeCoroutine(coroutine);
+  return coroutine->_PP->wakeCoroutine(coroutine);
 }
 
 void CoroutineWaitList::forgetCoroutine(CoroutineHandle *coroutine) {
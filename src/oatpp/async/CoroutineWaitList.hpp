@@ -60,7 +60,7 @@ private:
   std::mutex m_lock;
   Listener* m_listener = nullptr;
 private:
-  void removeCoroutine(CoroutineHandle* coroutine); //<-- Calls Processor
+  bool removeCoroutine(CoroutineHandle* coroutine); //<-- Calls Processor
   void forgetCoroutine(CoroutineHandle* coroutine); //<-- Called From Processor
 protected:
   /*
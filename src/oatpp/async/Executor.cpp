@@ -25,6 +25,7 @@
 #include "Executor.hpp"
 
 #include "oatpp/async/worker/IOEventWorker.hpp"
+#include "oatpp/async/worker/IOUringWorker.hpp"
 #include "oatpp/async/worker/IOWorker.hpp"
 #include "oatpp/async/worker/TimerWorker.hpp"
 
@@ -38,14 +39,16 @@ namespace oatpp { namespace async {
 Executor::SubmissionProcessor::SubmissionProcessor()
   : worker::Worker(worker::Worker::Type::PROCESSOR)
   , m_isRunning(true)
-{
-  m_thread = std::thread(&Executor::SubmissionProcessor::run, this);
-}
+{}
 
 oatpp::async::Processor& Executor::SubmissionProcessor::getProcessor() {
   return m_processor;
 }
 
+void Executor::SubmissionProcessor::start() {
+  m_thread = std::thread(&Executor::SubmissionProcessor::run, this);
+}
+
 void Executor::SubmissionProcessor::run() {
   
   while(m_isRunning) {
@@ -114,6 +117,25 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
       break;
     }
 
+    case IO_WORKER_TYPE_URING: {
+      try {
+        for (v_int32 i = 0; i < ioWorkersCount; i++) {
+          ioWorkers.push_back(std::make_shared<worker::IOUringWorker>());
+        }
+      } catch (std::runtime_error& e) {
+        OATPP_LOGW("[oatpp::async::Executor::Executor()]", "Unable to create io_uring worker: %s. Using event I/O workers.", e.what())
+        for(auto& worker : ioWorkers) {
+          worker->stop();
+          worker->join();
+        }
+        ioWorkers.clear();
+        for (v_int32 i = 0; i < ioWorkersCount; i++) {
+          ioWorkers.push_back(std::make_shared<worker::IOEventWorkerForeman>());
+        }
+      }
+      break;
+    }
+
     default:
       throw std::runtime_error("[oatpp::async::Executor::Executor()]: Error. Unknown IO worker type.");
 
@@ -129,6 +151,17 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
 
   linkWorkers(timerWorkers);
 
+  for(auto& thief : m_processorWorkers) {
+    for(auto& victim : m_processorWorkers) {
+      thief->getProcessor().addStealTarget(&victim->getProcessor());
+    }
+  }
+
+  /* start processors only when all workers are linked */
+  for(auto& p : m_processorWorkers) {
+    p->start();
+  }
+
 }
 
 v_int32 Executor::chooseProcessorWorkersCount(v_int32 processorWorkersCount) {
@@ -175,6 +208,11 @@ v_int32 Executor::chooseIOWorkerType(v_int32 ioWorkerType) {
 #endif
   }
 
+  if(ioWorkerType == IO_WORKER_TYPE_URING && !worker::IOUringWorker::isSupported()) {
+    OATPP_LOGW("[oatpp::async::Executor::chooseIOWorkerType()]", "io_uring is not available. Using default I/O worker type.")
+    return chooseIOWorkerType(VALUE_SUGGESTED);
+  }
+
   return ioWorkerType;
 
 }
@@ -248,6 +286,19 @@ v_int32 Executor::getTasksCount() {
 
 }
 
+std::vector<Processor::Stats> Executor::getProcessorsStats() {
+
+  std::vector<Processor::Stats> result;
+  result.reserve(m_processorWorkers.size());
+
+  for(const auto& procWorker : m_processorWorkers) {
+    result.push_back(procWorker->getProcessor().getStats());
+  }
+
+  return result;
+
+}
+
 void Executor::waitTasksFinished(const std::chrono::duration<v_int64, std::micro>& timeout) {
 
   auto startTime = std::chrono::system_clock::now();
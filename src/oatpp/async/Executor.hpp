@@ -40,7 +40,7 @@ namespace oatpp { namespace async {
 /**
  * Asynchronous Executor.<br>
  * Executes coroutines in multiple &id:oatpp::async::Processor;
- * allocating one thread per processor.
+ * allocating one thread per processor. Processors steal tasks from each other to keep the load balanced.
  */
 class Executor {
 private:
@@ -63,6 +63,8 @@ private:
 
     oatpp::async::Processor& getProcessor();
 
+    void start();
+
     void pushTasks(utils::FastQueue<CoroutineHandle>& tasks) override GPP_ATTRIBUTE(noreturn);
 
     void pushOneTask(CoroutineHandle* task) override GPP_ATTRIBUTE(noreturn);
@@ -93,6 +95,13 @@ public:
    * IO Worker type event.
    */
   static constexpr const v_int32 IO_WORKER_TYPE_EVENT = 1;
+
+  /**
+   * IO Worker type io_uring (Linux only). Readiness of I/O handles is polled with io_uring -
+   * reads and writes are not submitted to the ring. <br>
+   * Falls back to &l:Executor::IO_WORKER_TYPE_EVENT; if io_uring is not available or the ring can't be set up.
+   */
+  static constexpr const v_int32 IO_WORKER_TYPE_URING = 2;
 private:
   std::atomic<v_uint32> m_balancer;
 private:
@@ -162,6 +171,12 @@ public:
    * @param timeout
    */
   void waitTasksFinished(const std::chrono::duration<v_int64, std::micro>& timeout = std::chrono::minutes(1));
+
+  /**
+   * Get statistics of each processor. Use it to check how the load is balanced between processors.
+   * @return - `std::vector` of &id:oatpp::async::Processor::Stats;.
+   */
+  std::vector<Processor::Stats> getProcessorsStats();
   
 };
   
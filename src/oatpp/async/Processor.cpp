@@ -52,6 +52,12 @@ void Processor::addWorker(const std::shared_ptr<worker::Worker>& worker) {
 
 }
 
+void Processor::addStealTarget(Processor* processor) {
+  if(processor != this) {
+    m_stealTargets.push_back(processor);
+  }
+}
+
 void Processor::popIOTask(CoroutineHandle* coroutine) {
   if(m_ioPopQueues.size() > 0) {
     auto &queue = m_ioPopQueues[(++m_ioBalancer) % m_ioPopQueues.size()];
@@ -113,27 +119,75 @@ void Processor::addCoroutine(CoroutineHandle* coroutine) {
 }
 
 void Processor::pushOneTask(CoroutineHandle* coroutine) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_pushList.pushBack(coroutine);
-  }
-  m_taskCondition.notify_one();
+  m_pushQueue.push(coroutine);
+  notifyTasksPushed();
 }
 
 void Processor::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    utils::FastQueue<CoroutineHandle>::moveAll(tasks, m_pushList);
+  m_pushQueue.pushAll(tasks);
+  notifyTasksPushed();
+}
+
+void Processor::notifyTasksPushed() {
+  /* m_idle is set before the queues are checked in waitForTasks() - if it's not set, the processor will see the tasks */
+  if(m_idle) {
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    m_waitCondition.notify_one();
   }
-  m_taskCondition.notify_one();
 }
 
 void Processor::waitForTasks() {
+  std::unique_lock<std::mutex> lock(m_waitMutex);
+  m_idle = true;
+  if(m_pushQueue.empty() && m_taskQueue.empty() && m_running) {
+    requestTasks();
+  }
+  while (m_pushQueue.empty() && m_taskQueue.empty() && m_running) {
+    /* sleep deadline can only be moved closer by this thread - no need to be notified about it */
+    auto deadline = m_sleepDeadline.load();
+    if(deadline == NO_DEADLINE) {
+      m_waitCondition.wait(lock);
+    } else {
+      std::chrono::system_clock::time_point timePoint{std::chrono::microseconds(deadline)};
+      if(m_waitCondition.wait_until(lock, timePoint) == std::cv_status::timeout) {
+        break;
+      }
+    }
+  }
+  m_idle = false;
+}
 
-  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_taskLock);
-  while (m_pushList.first == nullptr && m_taskList.empty() && m_running) {
-    m_taskCondition.wait(lock);
+void Processor::requestTasks() {
+  for(auto victim : m_stealTargets) {
+    /* m_queue belongs to the victim's thread - leave a request there, the victim serves it at the end of its iteration */
+    if(!victim->m_idle && victim->m_running && victim->m_tasksCounter > 1) {
+      Processor* expected = nullptr;
+      victim->m_stealRequest.compare_exchange_strong(expected, this);
+    }
   }
+}
+
+void Processor::serveStealRequest() {
+
+  auto thief = m_stealRequest.exchange(nullptr);
+
+  /* thief may have found other work since it left the request */
+  if(thief == nullptr || m_queue.count < 2 || !thief->m_idle || !thief->m_running) {
+    return;
+  }
+
+  utils::FastQueue<CoroutineHandle> coroutines;
+  utils::FastQueue<CoroutineHandle>::moveTail(m_queue, m_queue.count / 2, coroutines);
+
+  for(auto curr = coroutines.first; curr != nullptr; curr = curr->_ref) {
+    curr->_PP = thief;
+  }
+
+  thief->m_tasksCounter += coroutines.count;
+  thief->m_stolenTasksCounter += coroutines.count;
+  m_tasksCounter -= coroutines.count;
+
+  thief->pushTasks(coroutines);
 
 }
 
@@ -153,23 +207,19 @@ void Processor::popTasks() {
 
 }
 
-void Processor::consumeAllTasks() {
-  for(auto& submission : m_taskList) {
-    m_queue.pushBack(submission->createCoroutine(this));
-  }
-  m_taskList.clear();
-}
-
 void Processor::pushQueues() {
 
-  utils::FastQueue<CoroutineHandle> tmpList;
+  utils::FastQueue<TaskSubmission> submissions;
+  m_taskQueue.popAll(submissions);
 
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    consumeAllTasks();
-    utils::FastQueue<CoroutineHandle>::moveAll(m_pushList, tmpList);
+  while(submissions.first != nullptr) {
+    std::unique_ptr<TaskSubmission> submission(submissions.popFront());
+    m_queue.pushBack(submission->createCoroutine(this));
   }
 
+  utils::FastQueue<CoroutineHandle> tmpList;
+  m_pushQueue.popAll(tmpList);
+
   while(tmpList.first != nullptr) {
     addCoroutine(tmpList.popFront());
   }
@@ -177,60 +227,86 @@ void Processor::pushQueues() {
 }
 
 void Processor::putCoroutineToSleep(CoroutineHandle* ch) {
-  if(ch->_SCH_A.m_data.waitListData.timePointMicroseconds == 0) {
-    std::lock_guard<std::mutex> lock(m_sleepMutex);
+  auto timePoint = ch->_SCH_A.m_data.waitListData.timePointMicroseconds;
+  std::lock_guard<std::mutex> lock(m_sleepMutex);
+  if(timePoint == 0) {
     m_sleepNoTimeSet.insert(ch);
   } else {
-    std::lock_guard<std::mutex> lock(m_sleepMutex);
-    m_sleepTimeSet.insert(ch);
-    m_sleepCV.notify_one();
+    m_sleepTimeSet.insert({timePoint, ch});
+    updateSleepDeadline();
   }
 }
 
-void Processor::wakeCoroutine(CoroutineHandle* ch) {
-  if(ch->_SCH_A.m_data.waitListData.timePointMicroseconds == 0) {
-    std::lock_guard<std::mutex> lock(m_sleepMutex);
-    m_sleepNoTimeSet.erase(ch);
-  } else {
+bool Processor::wakeCoroutine(CoroutineHandle* ch) {
+
+  auto timePoint = ch->_SCH_A.m_data.waitListData.timePointMicroseconds;
+
+  {
     std::lock_guard<std::mutex> lock(m_sleepMutex);
-    m_sleepTimeSet.erase(ch);
+    if(timePoint == 0) {
+      if(m_sleepNoTimeSet.erase(ch) == 0) {
+        return false;
+      }
+    } else {
+      /* coroutine is already timed-out and is being woken by checkCoroutinesSleep() */
+      if(m_sleepTimeSet.erase({timePoint, ch}) == 0) {
+        return false;
+      }
+      updateSleepDeadline();
+    }
   }
+
   ch->_SCH_A = Action::createActionByType(Action::TYPE_NONE);
   pushOneTask(ch);
+  return true;
+
+}
+
+void Processor::updateSleepDeadline() {
+  if(m_sleepTimeSet.empty()) {
+    m_sleepDeadline = NO_DEADLINE;
+  } else {
+    m_sleepDeadline = m_sleepTimeSet.begin()->first;
+  }
 }
 
 void Processor::checkCoroutinesSleep() {
-  while (m_running) {
-    {
-      std::unique_lock<std::mutex> lock{m_sleepMutex};
-      while (m_running && m_sleepTimeSet.empty()) {
-        m_sleepCV.wait(lock);
-      }
 
-      auto now = oatpp::Environment::getMicroTickCount();
-      for(auto it = m_sleepTimeSet.begin(); it != m_sleepTimeSet.end();) {
-        auto ch = *it;
-        if(ch->_SCH_A.m_data.waitListData.timePointMicroseconds < now) {
-          it = m_sleepTimeSet.erase(it);
-          ch->_SCH_A.m_data.waitListData.waitList->forgetCoroutine(ch);
-          ch->_SCH_A = Action::createActionByType(Action::TYPE_NONE);
-          pushOneTask(ch);
-        } else {
-          it ++;
-        }
-      }
+  auto deadline = m_sleepDeadline.load();
+  if(deadline == NO_DEADLINE || deadline > oatpp::Environment::getMicroTickCount()) {
+    return;
+  }
 
+  utils::FastQueue<CoroutineHandle> timedOut;
+
+  {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    auto now = oatpp::Environment::getMicroTickCount();
+    auto it = m_sleepTimeSet.begin();
+    while(it != m_sleepTimeSet.end() && it->first <= now) {
+      timedOut.pushBack(it->second);
+      it = m_sleepTimeSet.erase(it);
     }
+    updateSleepDeadline();
+  }
 
-    if(m_running) std::this_thread::sleep_for(std::chrono::milliseconds{100});
+  /* wait-list lock is taken without m_sleepMutex held - wait-list calls wakeCoroutine() under its own lock */
+  while(timedOut.first != nullptr) {
+    auto ch = timedOut.popFront();
+    ch->_SCH_A.m_data.waitListData.waitList->forgetCoroutine(ch);
+    ch->_SCH_A = Action::createActionByType(Action::TYPE_NONE);
+    m_queue.pushBack(ch);
   }
+
 }
 
 bool Processor::iterate(v_int32 numIterations) {
 
   pushQueues();
+  checkCoroutinesSleep();
 
-  for(v_int32 i = 0; i < numIterations; i++) {
+  v_int32 i = 0;
+  for(; i < numIterations; i++) {
 
     auto CP = m_queue.first;
     if (CP == nullptr) {
@@ -273,26 +349,31 @@ bool Processor::iterate(v_int32 numIterations) {
   }
 
   popTasks();
+  serveStealRequest();
+
+  m_iterationsCounter.fetch_add(i, std::memory_order_relaxed);
 
-  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-  return m_queue.first != nullptr || m_pushList.first != nullptr || !m_taskList.empty();
+  return m_queue.first != nullptr || !m_pushQueue.empty() || !m_taskQueue.empty();
   
 }
 
 void Processor::stop() {
   {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
+    std::lock_guard<std::mutex> lock(m_waitMutex);
     m_running = false;
   }
-  m_taskCondition.notify_one();
-  m_sleepCV.notify_one();
-
-  m_sleepSetTask.join();
-
+  m_waitCondition.notify_one();
 }
 
 v_int32 Processor::getTasksCount() {
   return m_tasksCounter.load();
 }
 
+Processor::Stats Processor::getStats() {
+  Stats stats;
+  stats.iterations = m_iterationsCounter.load();
+  stats.stolenTasks = m_stolenTasksCounter.load();
+  return stats;
+}
+
 }}
@@ -28,12 +28,11 @@
 
 #include "./Coroutine.hpp"
 #include "./CoroutineWaitList.hpp"
-#include "oatpp/async/utils/FastQueue.hpp"
-#include "oatpp/concurrency/SpinLock.hpp"
+#include "oatpp/async/utils/MPSCQueue.hpp"
 
 #include <thread>
+#include <limits>
 #include <condition_variable>
-#include <list>
 #include <mutex>
 #include <set>
 #include <vector>
@@ -47,9 +46,30 @@ namespace oatpp { namespace async {
  */
 class Processor {
     friend class CoroutineWaitList;
+public:
+
+  /**
+   * Processor statistics. Use it to check how the load is balanced between processors.
+   */
+  struct Stats {
+
+    /**
+     * Number of coroutine iterations made by the processor.
+     */
+    v_int64 iterations;
+
+    /**
+     * Number of tasks the processor took over from other processors.
+     */
+    v_int64 stolenTasks;
+
+  };
+
 private:
 
   class TaskSubmission {
+  public:
+    TaskSubmission* _ref = nullptr; // pointer to next submission in queue
   public:
     virtual ~TaskSubmission() = default;
     virtual CoroutineHandle* createCoroutine(Processor* processor) = 0;
@@ -103,24 +123,34 @@ private:
 
 private:
 
+  static constexpr v_int64 NO_DEADLINE = std::numeric_limits<v_int64>::max();
+
   std::unordered_set<CoroutineHandle*> m_sleepNoTimeSet;
-  std::unordered_set<CoroutineHandle*> m_sleepTimeSet;
+  std::set<std::pair<v_int64, CoroutineHandle*>> m_sleepTimeSet;
   std::mutex m_sleepMutex;
-  std::condition_variable m_sleepCV;
-
-  std::thread m_sleepSetTask{&Processor::checkCoroutinesSleep, this};
+  /* earliest time point in m_sleepTimeSet */
+  std::atomic<v_int64> m_sleepDeadline{NO_DEADLINE};
 
 private:
 
-  oatpp::concurrency::SpinLock m_taskLock;
-  std::condition_variable_any m_taskCondition;
-  std::list<std::shared_ptr<TaskSubmission>> m_taskList;
-  utils::FastQueue<CoroutineHandle> m_pushList;
+  utils::MPSCQueue<TaskSubmission> m_taskQueue;
+  utils::MPSCQueue<CoroutineHandle> m_pushQueue;
+  std::mutex m_waitMutex;
+  std::condition_variable m_waitCondition;
 
 private:
 
   utils::FastQueue<CoroutineHandle> m_queue;
 
+private:
+
+  std::vector<Processor*> m_stealTargets;
+  std::atomic_bool m_idle{false};
+  std::atomic<v_int64> m_iterationsCounter{0};
+  std::atomic<v_int64> m_stolenTasksCounter{0};
+  /* idle processor waiting for this processor to hand over the tail of m_queue */
+  std::atomic<Processor*> m_stealRequest{nullptr};
+
 private:
   std::atomic_bool m_running{true};
   std::atomic<v_int32> m_tasksCounter{0};
@@ -129,13 +159,17 @@ private:
   void popIOTask(CoroutineHandle* coroutine);
   void popTimerTask(CoroutineHandle* coroutine);
 
-  void consumeAllTasks();
   void addCoroutine(CoroutineHandle* coroutine);
   void popTasks();
   void pushQueues();
+  void notifyTasksPushed();
+
+  void requestTasks();
+  void serveStealRequest();
 
   void putCoroutineToSleep(CoroutineHandle* ch);
-  void wakeCoroutine(CoroutineHandle* ch);
+  bool wakeCoroutine(CoroutineHandle* ch);
+  void updateSleepDeadline();
   void checkCoroutinesSleep();
 
 public:
@@ -148,6 +182,15 @@ public:
    */
   void addWorker(const std::shared_ptr<worker::Worker>& worker);
 
+  /**
+   * Add processor to balance the load with. <br>
+   * Before going to sleep, processor asks busy targets for tasks. Target hands the tail half of its run queue
+   * over to the idle processor at the end of its next iteration. <br>
+   * *Note: targets have to be added before processor starts iterating.*
+   * @param processor - &id:oatpp::async::Processor;.
+   */
+  void addStealTarget(Processor* processor);
+
   /**
    * Push one Coroutine back to processor.
    * @param coroutine - &id:oatpp::async::CoroutineHandle; previously popped-out(rescheduled to coworker) from this processor.
@@ -168,17 +211,13 @@ public:
    */
   template<typename CoroutineType, typename ... Args>
   void execute(Args... params) {
-    auto submission = std::make_shared<SubmissionTemplate<CoroutineType, Args...>>(params...);
     ++ m_tasksCounter;
-    {
-      std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-      m_taskList.push_back(submission);
-    }
-    m_taskCondition.notify_one();
+    m_taskQueue.push(new SubmissionTemplate<CoroutineType, Args...>(params...));
+    notifyTasksPushed();
   }
 
   /**
-   * Sleep and wait for tasks.
+   * Sleep and wait for tasks or for the nearest timeout of the coroutine waiting in &id:oatpp::async::CoroutineWaitList;.
    */
   void waitForTasks();
 
@@ -200,6 +239,11 @@ public:
    */
   v_int32 getTasksCount();
 
+  /**
+   * Get processor statistics.
+   * @return - &l:Processor::Stats;.
+   */
+  Stats getStats();
   
 };
   
@@ -150,6 +150,42 @@ public:
 
   }
 
+  /**
+   * Move last `count` entries of `fromQueue` to the end of `toQueue`.
+   * @param fromQueue
+   * @param count
+   * @param toQueue
+   */
+  static void moveTail(FastQueue& fromQueue, v_int32 count, FastQueue& toQueue) {
+
+    if(count <= 0) {
+      return;
+    }
+
+    if(count >= fromQueue.count) {
+      moveAll(fromQueue, toQueue);
+      return;
+    }
+
+    T* newLast = fromQueue.first;
+    for(v_int32 i = 1; i < fromQueue.count - count; i ++) {
+      newLast = newLast->_ref;
+    }
+
+    if (toQueue.last == nullptr) {
+      toQueue.first = newLast->_ref;
+    } else {
+      toQueue.last->_ref = newLast->_ref;
+    }
+    toQueue.last = fromQueue.last;
+    toQueue.count += count;
+
+    newLast->_ref = nullptr;
+    fromQueue.last = newLast;
+    fromQueue.count -= count;
+
+  }
+
   void cutEntry(T* entry, T* prevEntry){
 
     if(prevEntry == nullptr) {
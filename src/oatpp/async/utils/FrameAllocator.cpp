@@ -0,0 +1,286 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "FrameAllocator.hpp"
+
+#include <mutex>
+#include <new>
+#include <unordered_set>
+#include <vector>
+
+namespace oatpp { namespace async { namespace utils {
+
+#if !defined(OATPP_DISABLE_POOL_ALLOCATIONS) && !defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
+
+namespace {
+
+constexpr std::size_t HEADER_SIZE = 16;
+constexpr std::size_t SLAB_SIZE = 64 * 1024;
+constexpr v_uint32 SIZE_CLASSES_COUNT = 6;
+constexpr std::size_t SIZE_CLASSES[SIZE_CLASSES_COUNT] = {64, 128, 256, 512, 1024, 2048};
+
+class Arena;
+
+struct FrameHeader {
+  Arena* arena; // nullptr for frames allocated directly from the global heap
+  v_uint32 sizeClass;
+};
+
+static_assert(sizeof(FrameHeader) <= HEADER_SIZE, "FrameHeader doesn't fit HEADER_SIZE");
+
+/* free frame reuses the memory of the frame header */
+struct FreeFrame {
+  FreeFrame* _ref;
+};
+
+class Arena {
+private:
+  FreeFrame* m_free[SIZE_CLASSES_COUNT];
+  std::atomic<FreeFrame*> m_remoteFree[SIZE_CLASSES_COUNT];
+  std::vector<void*> m_slabs;
+  char* m_slabPos;
+  char* m_slabEnd;
+  /* number of not-freed frames + 1 for the owner thread */
+  std::atomic<v_int64> m_refs;
+public:
+  std::atomic<v_int64> allocations;
+  std::atomic<v_int64> heapAllocations;
+private:
+
+  char* carve(std::size_t size) {
+    if(m_slabPos == nullptr || m_slabPos + size > m_slabEnd) {
+      m_slabPos = static_cast<char*>(::operator new(SLAB_SIZE));
+      m_slabEnd = m_slabPos + SLAB_SIZE;
+      m_slabs.push_back(m_slabPos);
+      heapAllocations.store(heapAllocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    char* result = m_slabPos;
+    m_slabPos += size;
+    return result;
+  }
+
+public:
+
+  Arena();
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  void* allocate(v_uint32 sizeClass) {
+
+    allocations.store(allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    FreeFrame* frame = m_free[sizeClass];
+    if(frame == nullptr) {
+      frame = m_remoteFree[sizeClass].exchange(nullptr, std::memory_order_acquire);
+    }
+
+    char* memory;
+    if(frame != nullptr) {
+      m_free[sizeClass] = frame->_ref;
+      memory = reinterpret_cast<char*>(frame);
+    } else {
+      memory = carve(SIZE_CLASSES[sizeClass]);
+    }
+
+    m_refs.fetch_add(1, std::memory_order_relaxed);
+
+    auto header = reinterpret_cast<FrameHeader*>(memory);
+    header->arena = this;
+    header->sizeClass = sizeClass;
+    return memory + HEADER_SIZE;
+
+  }
+
+  /* called by the owner thread */
+  void freeLocal(FrameHeader* header) {
+    auto sizeClass = header->sizeClass;
+    auto frame = reinterpret_cast<FreeFrame*>(header);
+    frame->_ref = m_free[sizeClass];
+    m_free[sizeClass] = frame;
+    release();
+  }
+
+  /* called by any thread other than the owner */
+  void freeRemote(FrameHeader* header) {
+    auto sizeClass = header->sizeClass;
+    auto frame = reinterpret_cast<FreeFrame*>(header);
+    FreeFrame* head = m_remoteFree[sizeClass].load(std::memory_order_relaxed);
+    do {
+      frame->_ref = head;
+    } while(!m_remoteFree[sizeClass].compare_exchange_weak(head, frame, std::memory_order_release, std::memory_order_relaxed));
+    release();
+  }
+
+  void release() {
+    if(m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+};
+
+class Registry {
+public:
+  std::mutex lock;
+  std::unordered_set<Arena*> arenas;
+  v_int64 retiredAllocations = 0;
+  v_int64 retiredHeapAllocations = 0;
+};
+
+/* never destroyed - frames can be freed during the static destruction */
+Registry& getRegistry() {
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+Arena::Arena()
+  : m_slabPos(nullptr)
+  , m_slabEnd(nullptr)
+  , m_refs(1)
+  , allocations(0)
+  , heapAllocations(0)
+{
+  for(v_uint32 i = 0; i < SIZE_CLASSES_COUNT; i ++) {
+    m_free[i] = nullptr;
+    m_remoteFree[i] = nullptr;
+  }
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  registry.arenas.insert(this);
+}
+
+Arena::~Arena() {
+  {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.arenas.erase(this);
+    registry.retiredAllocations += allocations.load();
+    registry.retiredHeapAllocations += heapAllocations.load();
+  }
+  for(auto slab : m_slabs) {
+    ::operator delete(slab);
+  }
+}
+
+/* arena outlives its thread while there are frames not freed */
+struct ThreadArena {
+
+  Arena* arena = nullptr;
+
+  ~ThreadArena() {
+    if(arena != nullptr) {
+      auto a = arena;
+      arena = nullptr;
+      a->release();
+    }
+  }
+
+  Arena* get() {
+    if(arena == nullptr) {
+      arena = new Arena();
+    }
+    return arena;
+  }
+
+};
+
+thread_local ThreadArena t_arena;
+
+}
+
+void* FrameAllocator::allocate(std::size_t size) {
+
+  auto arena = t_arena.get();
+  auto fullSize = size + HEADER_SIZE;
+
+  for(v_uint32 i = 0; i < SIZE_CLASSES_COUNT; i ++) {
+    if(fullSize <= SIZE_CLASSES[i]) {
+      return arena->allocate(i);
+    }
+  }
+
+  arena->allocations.store(arena->allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  arena->heapAllocations.store(arena->heapAllocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+  auto header = static_cast<FrameHeader*>(::operator new(fullSize));
+  header->arena = nullptr;
+  header->sizeClass = SIZE_CLASSES_COUNT;
+  return reinterpret_cast<char*>(header) + HEADER_SIZE;
+
+}
+
+void FrameAllocator::deallocate(void* ptr) {
+
+  if(ptr == nullptr) {
+    return;
+  }
+
+  auto header = reinterpret_cast<FrameHeader*>(static_cast<char*>(ptr) - HEADER_SIZE);
+  auto arena = header->arena;
+
+  if(arena == nullptr) {
+    ::operator delete(header);
+  } else if(arena == t_arena.arena) {
+    arena->freeLocal(header);
+  } else {
+    arena->freeRemote(header);
+  }
+
+}
+
+FrameAllocator::Stats FrameAllocator::getStats() {
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  Stats stats;
+  stats.allocations = registry.retiredAllocations;
+  stats.heapAllocations = registry.retiredHeapAllocations;
+  for(auto arena : registry.arenas) {
+    stats.allocations += arena->allocations.load(std::memory_order_relaxed);
+    stats.heapAllocations += arena->heapAllocations.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+#else
+
+void* FrameAllocator::allocate(std::size_t size) {
+  return ::operator new(size);
+}
+
+void FrameAllocator::deallocate(void* ptr) {
+  ::operator delete(ptr);
+}
+
+FrameAllocator::Stats FrameAllocator::getStats() {
+  Stats stats;
+  stats.allocations = 0;
+  stats.heapAllocations = 0;
+  return stats;
+}
+
+#endif
+
+}}}
@@ -0,0 +1,87 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_FrameAllocator_hpp
+#define oatpp_async_utils_FrameAllocator_hpp
+
+#include "oatpp/Environment.hpp"
+
+#include <atomic>
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Size-class slab allocator for coroutine frames and coroutine handles. <br>
+ * Each thread allocates from its own arena (in practice - one arena per &id:oatpp::async::Processor; thread).
+ * Freed frames are kept in the arena's free-lists and are reused without touching the global heap.
+ * Frames freed by a thread other than the owner are returned to the owner via a lock-free list. <br>
+ * Frames bigger than the biggest size class go directly to the global heap. <br>
+ * *Note: define `OATPP_DISABLE_POOL_ALLOCATIONS` to allocate all frames directly from the global heap.*
+ */
+class FrameAllocator {
+public:
+
+  /**
+   * Allocator statistics.
+   */
+  struct Stats {
+
+    /**
+     * Number of frames allocated.
+     */
+    v_int64 allocations;
+
+    /**
+     * Number of times the global heap was used - new slabs and frames too big for the size classes.
+     */
+    v_int64 heapAllocations;
+
+  };
+
+public:
+
+  /**
+   * Allocate frame.
+   * @param size - size of the frame.
+   * @return - pointer to the frame.
+   */
+  static void* allocate(std::size_t size);
+
+  /**
+   * Free frame previously allocated with &l:FrameAllocator::allocate ();. Can be called from any thread.
+   * @param ptr - pointer to the frame.
+   */
+  static void deallocate(void* ptr);
+
+  /**
+   * Get accumulated statistics of all threads.
+   * @return - &l:FrameAllocator::Stats;.
+   */
+  static Stats getStats();
+
+};
+
+}}}
+
+#endif // oatpp_async_utils_FrameAllocator_hpp
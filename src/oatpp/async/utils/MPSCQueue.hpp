@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_MPSCQueue_hpp
+#define oatpp_async_utils_MPSCQueue_hpp
+
+#include "./FastQueue.hpp"
+
+#include <atomic>
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Intrusive lock-free multi-producer single-consumer queue. <br>
+ * Entries are linked through their `_ref` field - same as in &id:oatpp::async::utils::FastQueue;.
+ * Producers push with a single CAS. Consumer takes all entries at once.
+ * @tparam T - entry type.
+ */
+template<typename T>
+class MPSCQueue {
+private:
+  /* the most recently pushed entry - entries are linked from newest to oldest */
+  std::atomic<T*> m_last;
+public:
+
+  MPSCQueue()
+    : m_last(nullptr)
+  {}
+
+  ~MPSCQueue() {
+    FastQueue<T> queue;
+    popAll(queue);
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  /**
+   * Push entry. Safe to call from multiple threads.
+   * @param entry
+   */
+  void push(T* entry) {
+    T* last = m_last.load(std::memory_order_relaxed);
+    do {
+      entry->_ref = last;
+    } while(!m_last.compare_exchange_weak(last, entry));
+  }
+
+  /**
+   * Push all entries of the queue preserving their order. Safe to call from multiple threads.
+   * @param queue - entries to push. Empty after the call.
+   */
+  void pushAll(FastQueue<T>& queue) {
+
+    if(queue.first == nullptr) {
+      return;
+    }
+
+    T* oldest = queue.first;
+    T* newest = nullptr;
+    T* curr = queue.first;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      curr->_ref = newest;
+      newest = curr;
+      curr = next;
+    }
+
+    queue.first = nullptr;
+    queue.last = nullptr;
+    queue.count = 0;
+
+    T* last = m_last.load(std::memory_order_relaxed);
+    do {
+      oldest->_ref = last;
+    } while(!m_last.compare_exchange_weak(last, newest));
+
+  }
+
+  /**
+   * Move all entries to the end of `toQueue` in the order they were pushed. Consumer only.
+   * @param toQueue
+   */
+  void popAll(FastQueue<T>& toQueue) {
+
+    T* curr = m_last.exchange(nullptr);
+    if(curr == nullptr) {
+      return;
+    }
+
+    FastQueue<T> queue;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      queue.pushFront(curr);
+      curr = next;
+    }
+
+    FastQueue<T>::moveAll(queue, toQueue);
+
+  }
+
+  /**
+   * Check if queue is empty.
+   * @return
+   */
+  bool empty() const {
+    return m_last.load() == nullptr;
+  }
+
+};
+
+}}}
+
+#endif /* oatpp_async_utils_MPSCQueue_hpp */
@@ -30,6 +30,7 @@
 
 #include <thread>
 #include <mutex>
+#include <unordered_map>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -65,12 +66,22 @@ class IOEventWorkerForeman; // FWD
  * Event-based implementation of I/O worker.
  * <ul>
  *   <li>`kqueue` based implementation - for Mac/BSD systems</li>
- *   <li>`epoll` based implementation - for Linux systems</li>
+ *   <li>`epoll` based implementation - for Linux systems.
+ *   I/O handle stays registered (disarmed, `EPOLLONESHOT`) after the coroutine leaves the worker,
+ *   so the next wait on the same handle costs one re-arm call - `EPOLL_CTL_MOD`.
+ *   The first wait on a handle costs two calls - failed `EPOLL_CTL_MOD` and `EPOLL_CTL_ADD`.</li>
  * </ul>
+ * *Note: the `epoll` registration is not fully persistent. Persistent edge-triggered registration
+ * with readiness tracked in user space would need no call per wait, but the worker is not notified
+ * when a handle is closed, and a stale registration of a reused handle number would never wake its next waiter.
+ * So each wait still costs one `epoll_ctl` call.*
  */
 class IOEventWorker : public Worker {
 private:
   static constexpr const v_int32 MAX_EVENTS = 10000;
+private:
+  static std::atomic<v_int64>& getEventControlCallsCounter();
+  static std::atomic<v_int64>& getSyscallsCounter();
 private:
   IOEventWorkerForeman* m_foreman;
   Action::IOEventType m_specialization;
@@ -84,6 +95,8 @@ private:
   v_int32 m_inEventsCount;
   v_int32 m_inEventsCapacity;
   std::unique_ptr<v_char8[]> m_outEvents;
+  /* epoll only - handles with an armed one-shot registration and the coroutine it's armed for */
+  std::unordered_map<oatpp::v_io_handle, CoroutineHandle*> m_armedHandles;
 private:
   std::thread m_thread;
 private:
@@ -138,6 +151,20 @@ public:
    */
   void detach() override;
 
+  /**
+   * Get number of calls made by all I/O event workers to register I/O waits in the event queue (`epoll_ctl`). <br>
+   * Use it to measure syscalls spent on I/O waits.
+   * @return - number of calls.
+   */
+  static v_int64 getEventControlCallsCount();
+
+  /**
+   * Get number of all syscalls made by all I/O event workers (`epoll` only). <br>
+   * Counts `epoll_ctl`, `epoll_wait` and reads/writes of the wakeup trigger.
+   * @return - number of syscalls.
+   */
+  static v_int64 getSyscallsCount();
+
 };
 
 /**
@@ -109,6 +109,24 @@ void IOEventWorker::detach() {
   m_thread.detach();
 }
 
+std::atomic<v_int64>& IOEventWorker::getEventControlCallsCounter() {
+  static std::atomic<v_int64> counter(0);
+  return counter;
+}
+
+std::atomic<v_int64>& IOEventWorker::getSyscallsCounter() {
+  static std::atomic<v_int64> counter(0);
+  return counter;
+}
+
+v_int64 IOEventWorker::getEventControlCallsCount() {
+  return getEventControlCallsCounter().load();
+}
+
+v_int64 IOEventWorker::getSyscallsCount() {
+  return getSyscallsCounter().load();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // IOEventWorkerForeman
 
@@ -86,6 +86,7 @@ void IOEventWorker::initEventQueue() {
 
 void IOEventWorker::triggerWakeup() {
   eventfd_write(m_wakeupTrigger, 1);
+  getSyscallsCounter().fetch_add(1, std::memory_order_relaxed);
 }
 
 void IOEventWorker::setTriggerEvent(p_char8 eventPtr) {
@@ -95,6 +96,7 @@ void IOEventWorker::setTriggerEvent(p_char8 eventPtr) {
 
 void IOEventWorker::setCoroutineEvent(CoroutineHandle* coroutine, int operation, p_char8 eventPtr) {
   (void) eventPtr;
+  (void) operation; // chosen by the handle registration state
 
   auto& action = getCoroutineScheduledAction(coroutine);
 
@@ -129,12 +131,40 @@ void IOEventWorker::setCoroutineEvent(CoroutineHandle* coroutine, int operation,
 
   }
 
-  auto res = epoll_ctl(m_eventQueueHandle, operation, action.getIOHandle(), &event);
+  auto handle = action.getIOHandle();
+  auto armed = m_armedHandles.find(handle);
+
+  /*
+   * A handle which is not armed is re-armed with MOD - it's expected to stay registered (disarmed) after the last wait.
+   * A handle still armed for another coroutine is added with ADD - it fails with EEXIST
+   * and the error is reported instead of taking the registration over and orphaning that coroutine.
+   * If the armed handle was closed, the system has removed it and ADD succeeds.
+   */
+  if(armed == m_armedHandles.end()) {
+    operation = EPOLL_CTL_MOD;
+  } else {
+    operation = EPOLL_CTL_ADD;
+  }
+
+  auto res = epoll_ctl(m_eventQueueHandle, operation, handle, &event);
+  getEventControlCallsCounter().fetch_add(1, std::memory_order_relaxed);
+  getSyscallsCounter().fetch_add(1, std::memory_order_relaxed);
+
+  /* handle was never registered, or was closed (and its number reused) after it was registered */
+  if(res == -1 && operation == EPOLL_CTL_MOD && errno == ENOENT) {
+    operation = EPOLL_CTL_ADD;
+    res = epoll_ctl(m_eventQueueHandle, operation, handle, &event);
+    getEventControlCallsCounter().fetch_add(1, std::memory_order_relaxed);
+    getSyscallsCounter().fetch_add(1, std::memory_order_relaxed);
+  }
+
   if(res == -1) {
     OATPP_LOGE("[oatpp::async::worker::IOEventWorker::setEpollEvent()]", "Error. Call to epoll_ctl failed. operation=%d, errno=%d", operation, errno)
     throw std::runtime_error("[oatpp::async::worker::IOEventWorker::setEpollEvent()]: Error. Call to epoll_ctl failed.");
   }
 
+  m_armedHandles[handle] = coroutine;
+
 }
 
 void IOEventWorker::consumeBacklog() {
@@ -157,6 +187,7 @@ void IOEventWorker::waitEvents() {
 
   epoll_event* outEvents = reinterpret_cast<epoll_event*>(m_outEvents.get());
   auto eventsCount = epoll_wait(m_eventQueueHandle, outEvents, MAX_EVENTS, -1);
+  getSyscallsCounter().fetch_add(1, std::memory_order_relaxed);
 
   if((eventsCount < 0) && (errno != EINTR)) {
     OATPP_LOGE("[oatpp::async::worker::IOEventWorker::waitEvents()]", "Error:\n"
@@ -181,14 +212,22 @@ void IOEventWorker::waitEvents() {
 
         eventfd_t value;
         eventfd_read(m_wakeupTrigger, &value);
+        getSyscallsCounter().fetch_add(1, std::memory_order_relaxed);
 
       } else {
 
         auto coroutine = reinterpret_cast<CoroutineHandle*>(dataPtr);
 
+        /* the one-shot registration is disarmed by the event */
+        m_armedHandles.erase(getCoroutineScheduledAction(coroutine).getIOHandle());
+
         Action action = coroutine->iterate();
 
-        int res;
+        /*
+         * Coroutines leaving the worker don't unregister the handle.
+         * It's disarmed (EPOLLONESHOT) and is re-armed by the next wait on the same handle.
+         * Closed handles are removed from the event queue by the system.
+         */
 
         switch(action.getIOEventCode() | m_specialization) {
 
@@ -213,50 +252,16 @@ void IOEventWorker::waitEvents() {
             break;
 
           case Action::CODE_IO_WAIT_RESCHEDULE:
-
-            res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_DEL, action.getIOHandle(), nullptr);
-            if(res == -1) {
-              OATPP_LOGE(
-                "[oatpp::async::worker::IOEventWorker::waitEvents()]",
-                "Error. Call to epoll_ctl failed. operation=%d, errno=%d. action_code=%d, worker_specialization=%d",
-                EPOLL_CTL_DEL, errno, action.getIOEventCode(), m_specialization
-              )
-              throw std::runtime_error("[oatpp::async::worker::IOEventWorker::waitEvents()]: Error. Call to epoll_ctl failed.");
-            }
-
             setCoroutineScheduledAction(coroutine, std::move(action));
             popQueue.pushBack(coroutine);
-
             break;
 
           case Action::CODE_IO_REPEAT_RESCHEDULE:
-
-            res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_DEL, action.getIOHandle(), nullptr);
-            if(res == -1) {
-              OATPP_LOGE(
-                "[oatpp::async::worker::IOEventWorker::waitEvents()]",
-                "Error. Call to epoll_ctl failed. operation=%d, errno=%d. action_code=%d, worker_specialization=%d",
-                EPOLL_CTL_DEL, errno, action.getIOEventCode(), m_specialization
-              )
-              throw std::runtime_error("[oatpp::async::worker::IOEventWorker::waitEvents()]: Error. Call to epoll_ctl failed.");
-            }
-
             setCoroutineScheduledAction(coroutine, std::move(action));
             popQueue.pushBack(coroutine);
-
             break;
 
-
           default:
-
-            auto& prevAction = getCoroutineScheduledAction(coroutine);
-
-            res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_DEL, prevAction.getIOHandle(), nullptr);
-            if(res == -1) {
-              OATPP_LOGE("[oatpp::async::worker::IOEventWorker::waitEvents()]", "Error. Call to epoll_ctl failed. operation=%d, errno=%d", EPOLL_CTL_DEL, errno)
-              throw std::runtime_error("[oatpp::async::worker::IOEventWorker::waitEvents()]: Error. Call to epoll_ctl failed.");
-            }
-
             setCoroutineScheduledAction(coroutine, std::move(action));
             getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
 
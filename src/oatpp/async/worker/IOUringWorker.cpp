@@ -0,0 +1,460 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOUringWorker.hpp"
+
+#include "oatpp/async/Processor.hpp"
+
+#ifdef OATPP_IO_URING_INTERFACE
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+
+#endif
+
+namespace oatpp { namespace async { namespace worker {
+
+std::atomic<v_int64>& IOUringWorker::getEnterCallsCounter() {
+  static std::atomic<v_int64> counter(0);
+  return counter;
+}
+
+v_int64 IOUringWorker::getEnterCallsCount() {
+  return getEnterCallsCounter().load();
+}
+
+#ifdef OATPP_IO_URING_INTERFACE
+
+namespace {
+
+/* user data of the wakeup-trigger poll - coroutine pointers are never null */
+constexpr v_uint64 WAKEUP_USER_DATA = 0;
+
+int ioUringSetup(v_uint32 entries, io_uring_params* params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringSetup(v_uint32 sqEntries, v_uint32 cqEntries, io_uring_params* params) {
+  std::memset(params, 0, sizeof(io_uring_params));
+  params->flags = IORING_SETUP_CQSIZE;
+  params->cq_entries = cqEntries;
+  return ioUringSetup(sqEntries, params);
+}
+
+int ioUringEnter(int ringHandle, v_uint32 toSubmit, v_uint32 minComplete, v_uint32 flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ringHandle, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+}
+
+IOUringWorker::IOUringWorker()
+  : Worker(Type::IO)
+  , m_running(true)
+  , m_ringHandle(INVALID_IO_HANDLE)
+  , m_wakeupTrigger(INVALID_IO_HANDLE)
+  , m_sqRing(nullptr)
+  , m_sqRingSize(0)
+  , m_cqRing(nullptr)
+  , m_cqRingSize(0)
+  , m_sqes(nullptr)
+  , m_sqesSize(0)
+  , m_sqTail(nullptr)
+  , m_sqHead(nullptr)
+  , m_sqMask(0)
+  , m_sqEntries(0)
+  , m_sqArray(nullptr)
+  , m_cqHead(nullptr)
+  , m_cqTail(nullptr)
+  , m_cqMask(0)
+  , m_cqes(nullptr)
+  , m_toSubmit(0)
+  , m_wakeupReadOverflow(false)
+{
+  initRing();
+  m_thread = std::thread(&IOUringWorker::run, this);
+}
+
+IOUringWorker::~IOUringWorker() {
+  for(auto coroutine : m_parked) {
+    delete coroutine;
+  }
+  m_parked.clear();
+  m_sqOverflow.clear();
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    m_backlog.clear();
+  }
+  freeRing();
+}
+
+bool IOUringWorker::isSupported() {
+  static const bool supported = [] {
+    io_uring_params params;
+    auto handle = ioUringSetup(SQ_ENTRIES, CQ_ENTRIES, &params);
+    if(handle < 0) {
+      return false;
+    }
+    ::close(handle);
+    return true;
+  }();
+  return supported;
+}
+
+void IOUringWorker::initRing() {
+
+  io_uring_params params;
+  m_ringHandle = ioUringSetup(SQ_ENTRIES, CQ_ENTRIES, &params);
+  if(m_ringHandle < 0) {
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::initRing()]", "Error. Call to io_uring_setup() failed. errno=%d", errno)
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Call to io_uring_setup() failed.");
+  }
+
+  m_sqRingSize = static_cast<v_buff_size>(params.sq_off.array + params.sq_entries * sizeof(v_uint32));
+  m_cqRingSize = static_cast<v_buff_size>(params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+
+  bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if(singleMap && m_cqRingSize > m_sqRingSize) {
+    m_sqRingSize = m_cqRingSize;
+  }
+
+  m_sqRing = ::mmap(nullptr, static_cast<size_t>(m_sqRingSize), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    m_ringHandle, IORING_OFF_SQ_RING);
+  if(m_sqRing == MAP_FAILED) {
+    m_sqRing = nullptr;
+    freeRing();
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Unable to map submission queue.");
+  }
+
+  if(singleMap) {
+    m_cqRing = m_sqRing;
+    m_cqRingSize = 0;
+  } else {
+    m_cqRing = ::mmap(nullptr, static_cast<size_t>(m_cqRingSize), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      m_ringHandle, IORING_OFF_CQ_RING);
+    if(m_cqRing == MAP_FAILED) {
+      m_cqRing = nullptr;
+      freeRing();
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Unable to map completion queue.");
+    }
+  }
+
+  m_sqesSize = static_cast<v_buff_size>(params.sq_entries * sizeof(io_uring_sqe));
+  m_sqes = ::mmap(nullptr, static_cast<size_t>(m_sqesSize), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                  m_ringHandle, IORING_OFF_SQES);
+  if(m_sqes == MAP_FAILED) {
+    m_sqes = nullptr;
+    freeRing();
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Unable to map submission entries.");
+  }
+
+  auto sq = static_cast<v_char8*>(m_sqRing);
+  m_sqHead = reinterpret_cast<v_uint32*>(sq + params.sq_off.head);
+  m_sqTail = reinterpret_cast<v_uint32*>(sq + params.sq_off.tail);
+  m_sqMask = *reinterpret_cast<v_uint32*>(sq + params.sq_off.ring_mask);
+  m_sqEntries = *reinterpret_cast<v_uint32*>(sq + params.sq_off.ring_entries);
+  m_sqArray = reinterpret_cast<v_uint32*>(sq + params.sq_off.array);
+
+  auto cq = static_cast<v_char8*>(m_cqRing);
+  m_cqHead = reinterpret_cast<v_uint32*>(cq + params.cq_off.head);
+  m_cqTail = reinterpret_cast<v_uint32*>(cq + params.cq_off.tail);
+  m_cqMask = *reinterpret_cast<v_uint32*>(cq + params.cq_off.ring_mask);
+  m_cqes = cq + params.cq_off.cqes;
+
+  m_wakeupTrigger = ::eventfd(0, EFD_NONBLOCK);
+  if(m_wakeupTrigger == -1) {
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::initRing()]", "Error. Call to ::eventfd() failed. errno=%d", errno)
+    freeRing();
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Call to ::eventfd() failed.");
+  }
+
+  pushWakeupRead();
+
+}
+
+void IOUringWorker::freeRing() {
+  if(m_sqes != nullptr) {
+    ::munmap(m_sqes, static_cast<size_t>(m_sqesSize));
+    m_sqes = nullptr;
+  }
+  if(m_cqRing != nullptr && m_cqRing != m_sqRing) {
+    ::munmap(m_cqRing, static_cast<size_t>(m_cqRingSize));
+  }
+  m_cqRing = nullptr;
+  if(m_sqRing != nullptr) {
+    ::munmap(m_sqRing, static_cast<size_t>(m_sqRingSize));
+    m_sqRing = nullptr;
+  }
+  if(m_ringHandle >= 0) {
+    ::close(m_ringHandle);
+    m_ringHandle = INVALID_IO_HANDLE;
+  }
+  if(m_wakeupTrigger >= 0) {
+    ::close(m_wakeupTrigger);
+    m_wakeupTrigger = INVALID_IO_HANDLE;
+  }
+}
+
+bool IOUringWorker::pushPoll(v_io_handle handle, v_uint32 events, v_uint64 userData) {
+
+  v_uint32 tail = *m_sqTail;
+  if(tail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE) == m_sqEntries) {
+    /* submission queue is full - submit without waiting */
+    enter(0);
+    if(tail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE) == m_sqEntries) {
+      /* kernel didn't take the entries (completion queue is overflown) */
+      return false;
+    }
+  }
+
+  auto index = tail & m_sqMask;
+  auto sqe = static_cast<io_uring_sqe*>(m_sqes) + index;
+  std::memset(sqe, 0, sizeof(io_uring_sqe));
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = handle;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  sqe->poll32_events = (events << 16) | (events >> 16);
+#else
+  sqe->poll32_events = events;
+#endif
+  sqe->user_data = userData;
+
+  m_sqArray[index] = index;
+  __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+  m_toSubmit ++;
+
+  return true;
+
+}
+
+void IOUringWorker::pushCoroutinePoll(CoroutineHandle* coroutine) {
+
+  auto& action = getCoroutineScheduledAction(coroutine);
+  bool pushed;
+
+  switch(action.getIOEventType()) {
+
+    case Action::IOEventType::IO_EVENT_READ:
+      pushed = pushPoll(action.getIOHandle(), POLLIN, reinterpret_cast<v_uint64>(coroutine));
+      break;
+
+    case Action::IOEventType::IO_EVENT_WRITE:
+      pushed = pushPoll(action.getIOHandle(), POLLOUT, reinterpret_cast<v_uint64>(coroutine));
+      break;
+
+    default:
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::pushCoroutinePoll()]: Error. Unknown Action Event Type.");
+
+  }
+
+  if(pushed) {
+    m_parked.insert(coroutine);
+  } else {
+    m_sqOverflow.pushBack(coroutine);
+  }
+
+}
+
+void IOUringWorker::pushWakeupRead() {
+  m_wakeupReadOverflow = !pushPoll(m_wakeupTrigger, POLLIN, WAKEUP_USER_DATA);
+}
+
+void IOUringWorker::enter(v_uint32 minComplete) {
+
+  v_uint32 flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+  while(true) {
+
+    auto res = ioUringEnter(m_ringHandle, m_toSubmit, minComplete, flags);
+    getEnterCallsCounter().fetch_add(1, std::memory_order_relaxed);
+
+    if(res >= 0) {
+      m_toSubmit -= static_cast<v_uint32>(res);
+      return;
+    }
+
+    if(errno == EINTR) {
+      continue;
+    }
+
+    if(errno == EAGAIN || errno == EBUSY) {
+      /* completion queue is overflown - entries stay in the submission queue until completions are processed */
+      return;
+    }
+
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::enter()]", "Error. Call to io_uring_enter() failed. errno=%d", errno)
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::enter()]: Error. Call to io_uring_enter() failed.");
+
+  }
+
+}
+
+void IOUringWorker::consumeBacklog() {
+
+  if(m_wakeupReadOverflow) {
+    pushWakeupRead();
+  }
+
+  /* polls which didn't fit the submission queue go first */
+  utils::FastQueue<CoroutineHandle> backlog;
+  utils::FastQueue<CoroutineHandle>::moveAll(m_sqOverflow, backlog);
+
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, backlog);
+  }
+
+  while(backlog.first != nullptr) {
+    pushCoroutinePoll(backlog.popFront());
+  }
+
+}
+
+void IOUringWorker::processCompletions() {
+
+  v_uint32 head = *m_cqHead;
+  v_uint32 tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+
+  while(head != tail) {
+
+    auto cqe = static_cast<io_uring_cqe*>(m_cqes) + (head & m_cqMask);
+    auto userData = cqe->user_data;
+    head ++;
+
+    /* release the entry before re-arming - submission may need room in the completion queue */
+    __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+
+    if(userData == WAKEUP_USER_DATA) {
+      eventfd_t value;
+      eventfd_read(m_wakeupTrigger, &value);
+      pushWakeupRead();
+      continue;
+    }
+
+    auto coroutine = reinterpret_cast<CoroutineHandle*>(userData);
+    m_parked.erase(coroutine);
+
+    Action action = coroutine->iterate();
+
+    switch(action.getType()) {
+
+      case Action::TYPE_IO_WAIT:
+      case Action::TYPE_IO_REPEAT:
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        pushCoroutinePoll(coroutine);
+        break;
+
+      default:
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+
+    }
+
+  }
+
+}
+
+void IOUringWorker::triggerWakeup() {
+  eventfd_write(m_wakeupTrigger, 1);
+}
+
+void IOUringWorker::run() {
+
+  while(m_running) {
+    consumeBacklog();
+    /* submit all new polls and wait for completions in one call */
+    if(m_sqOverflow.first == nullptr && !m_wakeupReadOverflow) {
+      enter(1);
+    } else {
+      enter(0);
+    }
+    processCompletions();
+  }
+
+}
+
+#else
+
+IOUringWorker::IOUringWorker()
+  : Worker(Type::IO)
+  , m_running(false)
+  , m_wakeupReadOverflow(false)
+{
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::IOUringWorker()]: Error. io_uring is not available on this platform.");
+}
+
+IOUringWorker::~IOUringWorker() {
+}
+
+bool IOUringWorker::isSupported() {
+  return false;
+}
+
+void IOUringWorker::run() {
+}
+
+void IOUringWorker::triggerWakeup() {
+}
+
+#endif
+
+void IOUringWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
+  if (tasks.first != nullptr) {
+    {
+      std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+      utils::FastQueue<CoroutineHandle>::moveAll(tasks, m_backlog);
+    }
+    triggerWakeup();
+  }
+}
+
+void IOUringWorker::pushOneTask(CoroutineHandle* task) {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+    m_backlog.pushBack(task);
+  }
+  triggerWakeup();
+}
+
+void IOUringWorker::stop() {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    m_running = false;
+  }
+  triggerWakeup();
+}
+
+void IOUringWorker::join() {
+  m_thread.join();
+}
+
+void IOUringWorker::detach() {
+  m_thread.detach();
+}
+
+}}}
@@ -0,0 +1,168 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_worker_IOUringWorker_hpp
+#define oatpp_async_worker_IOUringWorker_hpp
+
+#include "./Worker.hpp"
+#include "oatpp/concurrency/SpinLock.hpp"
+
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(OATPP_IO_URING_INTERFACE_DISABLED) && (defined(__linux__) || defined(linux) || defined(__linux))
+  #if defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+      #define OATPP_IO_URING_INTERFACE
+    #endif
+  #endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace oatpp { namespace async { namespace worker {
+
+/**
+ * io_uring based readiness (poll) implementation of I/O worker (Linux only). <br>
+ * Waits of all coroutines parked during one loop iteration are submitted as `IORING_OP_POLL_ADD` requests
+ * together with the wait for completions - in a single `io_uring_enter` call. <br>
+ * The worker only reports readiness - reads and writes are still done by coroutines with non-blocking calls. <br>
+ * One worker serves both read and write waits. <br>
+ * *Note: this is a poll backend. Completion-based I/O (`IORING_OP_RECV`/`IORING_OP_SEND` with registered buffers)
+ * is not implemented - coroutine I/O in oatpp is done by the coroutine itself, and the worker only receives waits.*<br>
+ * *Note: check &l:IOUringWorker::isSupported (); before creating the worker -
+ * kernel may lack io_uring support or it may be disabled. Constructor throws `std::runtime_error` if the ring can't be set up.*
+ */
+class IOUringWorker : public Worker {
+private:
+  static constexpr const v_uint32 SQ_ENTRIES = 1024;
+  static constexpr const v_uint32 CQ_ENTRIES = 16384;
+private:
+  static std::atomic<v_int64>& getEnterCallsCounter();
+private:
+  std::atomic<bool> m_running;
+  utils::FastQueue<CoroutineHandle> m_backlog;
+  oatpp::concurrency::SpinLock m_backlogLock;
+private:
+  oatpp::v_io_handle m_ringHandle;
+  oatpp::v_io_handle m_wakeupTrigger;
+  void* m_sqRing;
+  v_buff_size m_sqRingSize;
+  void* m_cqRing;
+  v_buff_size m_cqRingSize;
+  void* m_sqes;
+  v_buff_size m_sqesSize;
+  v_uint32* m_sqTail;
+  v_uint32* m_sqHead;
+  v_uint32 m_sqMask;
+  v_uint32 m_sqEntries;
+  v_uint32* m_sqArray;
+  v_uint32* m_cqHead;
+  v_uint32* m_cqTail;
+  v_uint32 m_cqMask;
+  void* m_cqes;
+  v_uint32 m_toSubmit;
+private:
+  /* polls which didn't fit the submission queue - pushed on the next loop iteration */
+  utils::FastQueue<CoroutineHandle> m_sqOverflow;
+  bool m_wakeupReadOverflow;
+  /* coroutines owned by the ring */
+  std::unordered_set<CoroutineHandle*> m_parked;
+private:
+  std::thread m_thread;
+private:
+  void initRing();
+  void freeRing();
+  bool pushPoll(v_io_handle handle, v_uint32 events, v_uint64 userData);
+  void pushCoroutinePoll(CoroutineHandle* coroutine);
+  void pushWakeupRead();
+  void enter(v_uint32 minComplete);
+  void consumeBacklog();
+  void processCompletions();
+  void triggerWakeup();
+public:
+
+  /**
+   * Constructor.
+   */
+  IOUringWorker();
+
+  /**
+   * Virtual destructor.
+   */
+  ~IOUringWorker() override;
+
+  /**
+   * Check if io_uring is available. <br>
+   * Probes the ring of the same size as used by the worker.
+   * @return - `true` if io_uring worker can be used.
+   */
+  static bool isSupported();
+
+  /**
+   * Get number of `io_uring_enter` calls made by all io_uring workers.
+   * @return - number of calls.
+   */
+  static v_int64 getEnterCallsCount();
+
+  /**
+   * Push list of tasks to worker.
+   * @param tasks - &id:oatpp::async::utils::FastQueue; of &id:oatpp::async::CoroutineHandle;.
+   */
+  void pushTasks(utils::FastQueue<CoroutineHandle>& tasks) override;
+
+  /**
+   * Push one task to worker.
+   * @param task - &id:CoroutineHandle;.
+   */
+  void pushOneTask(CoroutineHandle* task) override;
+
+  /**
+   * Run worker.
+   */
+  void run();
+
+  /**
+   * Break run loop.
+   */
+  void stop() override;
+
+  /**
+   * Join all worker-threads.
+   */
+  void join() override;
+
+  /**
+   * Detach all worker-threads.
+   */
+  void detach() override;
+
+};
+
+}}}
+
+#endif //oatpp_async_worker_IOUringWorker_hpp
@@ -26,6 +26,7 @@
 
 #include "oatpp/async/Processor.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 namespace oatpp { namespace async { namespace worker {
@@ -38,6 +39,12 @@ TimerWorker::TimerWorker(const std::chrono::duration<v_int64, std::micro>& granu
   m_thread = std::thread(&TimerWorker::run, this);
 }
 
+TimerWorker::~TimerWorker() {
+  for(auto& timer : m_timers) {
+    delete timer.coroutine;
+  }
+}
+
 void TimerWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
   {
     std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
@@ -48,12 +55,34 @@ void TimerWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
 
 void TimerWorker::consumeBacklog() {
 
-  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_backlogLock);
-  while (m_backlog.first == nullptr && m_queue.first == nullptr && m_running) {
-    m_backlogCondition.wait(lock);
+  utils::FastQueue<CoroutineHandle> backlog;
+
+  {
+    std::unique_lock<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    if(m_timers.empty()) {
+      while (m_backlog.first == nullptr && m_running) {
+        m_backlogCondition.wait(lock);
+      }
+    } else {
+      std::chrono::system_clock::time_point timePoint(std::chrono::microseconds(m_timers.front().timePointMicroseconds));
+      while (m_backlog.first == nullptr && m_running) {
+        if(m_backlogCondition.wait_until(lock, timePoint) == std::cv_status::timeout) {
+          break;
+        }
+      }
+    }
+    utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, backlog);
   }
-  utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, m_queue);
 
+  while(backlog.first != nullptr) {
+    addTimer(backlog.popFront());
+  }
+
+}
+
+void TimerWorker::addTimer(CoroutineHandle* coroutine) {
+  m_timers.push_back({getCoroutineScheduledAction(coroutine).getTimePointMicroseconds(), coroutine});
+  std::push_heap(m_timers.begin(), m_timers.end(), TimerCompare());
 }
 
 void TimerWorker::pushOneTask(CoroutineHandle* task) {
@@ -69,51 +98,36 @@ void TimerWorker::run() {
   while(m_running) {
 
     consumeBacklog();
-    auto curr = m_queue.first;
-    CoroutineHandle* prev = nullptr;
-
-    auto startTime = std::chrono::system_clock::now();
-    std::chrono::microseconds ms = std::chrono::duration_cast<std::chrono::microseconds>(startTime.time_since_epoch());
-    v_int64 tick = ms.count();
-
-    while(curr != nullptr) {
 
-      auto next = nextCoroutine(curr);
+    v_int64 tick = oatpp::Environment::getMicroTickCount();
 
-      const Action& schA = getCoroutineScheduledAction(curr);
+    while(!m_timers.empty() && m_timers.front().timePointMicroseconds <= tick) {
 
-      if(schA.getTimePointMicroseconds() < tick) {
+      std::pop_heap(m_timers.begin(), m_timers.end(), TimerCompare());
+      auto curr = m_timers.back().coroutine;
+      m_timers.pop_back();
 
-        Action action = curr->iterate();
+      Action action = curr->iterate();
 
-        switch(action.getType()) {
+      switch(action.getType()) {
 
-          case Action::TYPE_WAIT_REPEAT:
-            setCoroutineScheduledAction(curr, std::move(action));
-            break;
+        case Action::TYPE_WAIT_REPEAT:
+          setCoroutineScheduledAction(curr, std::move(action));
+          addTimer(curr);
+          break;
 
-          case Action::TYPE_IO_WAIT:
-            setCoroutineScheduledAction(curr, oatpp::async::Action::createWaitRepeatAction(0));
-            break;
+        case Action::TYPE_IO_WAIT:
+          setCoroutineScheduledAction(curr, oatpp::async::Action::createWaitRepeatAction(tick + m_granularity.count()));
+          addTimer(curr);
+          break;
 
-          default:
-            m_queue.cutEntry(curr, prev);
-            setCoroutineScheduledAction(curr, std::move(action));
-            getCoroutineProcessor(curr)->pushOneTask(curr);
-            curr = prev;
-            break;
-
-        }
+        default:
+          setCoroutineScheduledAction(curr, std::move(action));
+          getCoroutineProcessor(curr)->pushOneTask(curr);
+          break;
 
       }
 
-      prev = curr;
-      curr = next;
-    }
-
-    auto elapsed = std::chrono::system_clock::now() - startTime;
-    if(elapsed < m_granularity) {
-      std::this_thread::sleep_for(m_granularity - elapsed);
     }
 
   }
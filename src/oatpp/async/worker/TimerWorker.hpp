@@ -31,18 +31,34 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 namespace oatpp { namespace async { namespace worker {
 
 /**
  * Timer worker.
- * Used to wait for timer-scheduled coroutines.
+ * Used to wait for timer-scheduled coroutines. <br>
+ * Coroutines are kept in a min-heap ordered by their time points.
+ * Worker sleeps until the nearest time point or until new tasks are pushed.
  */
 class TimerWorker : public Worker {
+private:
+
+  struct Timer {
+    v_int64 timePointMicroseconds;
+    CoroutineHandle* coroutine;
+  };
+
+  struct TimerCompare {
+    bool operator()(const Timer& a, const Timer& b) const {
+      return a.timePointMicroseconds > b.timePointMicroseconds;
+    }
+  };
+
 private:
   std::atomic<bool> m_running;
   utils::FastQueue<CoroutineHandle> m_backlog;
-  utils::FastQueue<CoroutineHandle> m_queue;
+  std::vector<Timer> m_timers;
   oatpp::concurrency::SpinLock m_backlogLock;
   std::condition_variable_any m_backlogCondition;
 private:
@@ -51,14 +67,20 @@ private:
   std::thread m_thread;
 private:
   void consumeBacklog();
+  void addTimer(CoroutineHandle* coroutine);
 public:
 
   /**
    * Constructor.
-   * @param granularity - minimum possible time to wait.
+   * @param granularity - time to wait before coroutine which requested I/O wait in the timer is iterated again.
    */
   TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity = std::chrono::milliseconds(100));
 
+  /**
+   * Virtual destructor.
+   */
+  ~TimerWorker() override;
+
   /**
    * Push list of tasks to worker.
    * @param tasks - &id:oatpp::aysnc::utils::FastQueue; of &id:oatpp::async::CoroutineHandle;.
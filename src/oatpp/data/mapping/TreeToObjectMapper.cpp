@@ -287,7 +287,7 @@ oatpp::Void TreeToObjectMapper::mapObject(const TreeToObjectMapper* mapper, Stat
 
   auto dispatcher = static_cast<const oatpp::data::type::__class::AbstractObject::PolymorphicDispatcher*>(type->polymorphicDispatcher);
   auto object = dispatcher->createObject();
-  const auto& fieldsMap = dispatcher->getProperties()->getMap();
+  auto properties = dispatcher->getProperties();
 
   std::vector<std::pair<oatpp::BaseObject::Property*, const Tree*>> polymorphs;
 
@@ -298,10 +298,8 @@ oatpp::Void TreeToObjectMapper::mapObject(const TreeToObjectMapper* mapper, Stat
 
     const auto& pair = childrenOperator.getPair(i);
 
-    auto fieldIterator = fieldsMap.find(pair.first);
-    if(fieldIterator != fieldsMap.end()){
-
-      auto field = fieldIterator->second;
+    auto field = properties->find(pair.first->data(), static_cast<v_buff_size>(pair.first->size()));
+    if(field){
 
       if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
         polymorphs.emplace_back(field, pair.second); // store polymorphs for later processing.
@@ -167,10 +167,9 @@ const oatpp::Type* TypeResolver::findPropertyType(const oatpp::Type* baseType,
     } else if(pathPosition < path.size()) {
       if(baseType->classId.id == type::__class::AbstractObject::CLASS_ID.id) {
         auto dispatcher = static_cast<const type::__class::AbstractObject::PolymorphicDispatcher*>(baseType->polymorphicDispatcher);
-        const auto& map = dispatcher->getProperties()->getMap();
-        auto it = map.find(path[pathPosition]);
-        if(it != map.end()) {
-          return findPropertyType(it->second->type, path, pathPosition + 1, cache);
+        auto property = dispatcher->getProperties()->find(path[pathPosition]);
+        if(property) {
+          return findPropertyType(property->type, path, pathPosition + 1, cache);
         }
       }
       return nullptr;
@@ -204,10 +203,8 @@ type::Void TypeResolver::findPropertyValue(const type::Void& baseObject,
     } else if(pathPosition < path.size()) {
       if(baseType->classId.id == type::__class::AbstractObject::CLASS_ID.id && baseObject) {
         auto dispatcher = static_cast<const type::__class::AbstractObject::PolymorphicDispatcher*>(baseType->polymorphicDispatcher);
-        const auto& map = dispatcher->getProperties()->getMap();
-        auto it = map.find(path[pathPosition]);
-        if(it != map.end()) {
-          auto property = it->second;
+        auto property = dispatcher->getProperties()->find(path[pathPosition]);
+        if(property) {
           return findPropertyValue(property->getAsRef(static_cast<type::BaseObject*>(baseObject.get())), path, pathPosition + 1, cache);
         }
       }
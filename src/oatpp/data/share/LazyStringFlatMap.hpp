@@ -0,0 +1,562 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_data_share_LazyStringFlatMap_hpp
+#define oatpp_data_share_LazyStringFlatMap_hpp
+
+#include "./MemoryLabel.hpp"
+
+#include <array>
+#include <vector>
+
+namespace oatpp { namespace data { namespace share {
+
+/**
+ * Default key registry of &l:LazyStringFlatMultimap; - no keys are interned.
+ * @tparam Key - key type.
+ */
+template<typename Key>
+class NoKeyRegistry {
+public:
+
+  /**
+   * Ids of interned keys.
+   */
+  enum class Id : v_int32 {};
+
+  /**
+   * Number of interned keys.
+   */
+  static constexpr v_int32 SIZE = 0;
+
+  /**
+   * Get id of the key.
+   * @param key
+   * @param hash - hash of the key.
+   * @return - id of the key or `-1` if key is not interned.
+   */
+  static v_int32 getId(const Key& key, v_uint64 hash) {
+    (void) key;
+    (void) hash;
+    return -1;
+  }
+
+  /**
+   * Get interned key by id.
+   * @param id
+   * @return
+   */
+  static const Key& getKey(Id id) {
+    (void) id;
+    static const Key key;
+    return key;
+  }
+
+  /**
+   * Get precomputed hash of interned key.
+   * @param id
+   * @return
+   */
+  static v_uint64 getHash(Id id) {
+    (void) id;
+    return 0;
+  }
+
+};
+
+/**
+ * Flat multimap of memory labels - drop-in replacement for &id:oatpp::data::share::LazyStringMultimap;
+ * for small maps owned by a single thread, such as HTTP headers of one request. <br>
+ * Entries are kept in insertion order in a contiguous array. The first `InlineCapacity` entries live inside
+ * the object itself, so maps with fewer entries never allocate. Each entry stores the precomputed hash of its key
+ * which is compared before the key itself. <br>
+ * Keys known to `KeyRegistry` are interned to integer ids on insertion - lookups of such keys are array indexing.
+ * Overloads taking `KeyRegistry::Id` skip hashing of the key altogether. <br>
+ * *Note:* the map is NOT synchronized. `_LockFree` methods are kept for API compatibility.
+ * @tparam Key - one of: &id:oatpp::data::share::MemoryLabel;, &id:oatpp::data::share::StringKeyLabel;, &id:oatpp::data::share::StringKeyLabelCI;.
+ * @tparam Value - value label type.
+ * @tparam InlineCapacity - number of entries stored without heap allocation.
+ * @tparam KeyRegistry - registry of interned keys. See &l:NoKeyRegistry;.
+ */
+template<typename Key, typename Value = StringKeyLabel, v_int32 InlineCapacity = 16, typename KeyRegistry = NoKeyRegistry<Key>>
+class LazyStringFlatMultimap {
+public:
+  typedef oatpp::data::type::String String;
+
+  /**
+   * Id of the interned key.
+   */
+  typedef typename KeyRegistry::Id KeyId;
+public:
+
+  /**
+   * Map entry. Has `first` (key) and `second` (value) just like `std::pair`.
+   */
+  struct Entry : public std::pair<Key, Value> {
+
+    Entry() = default;
+
+    Entry(const Key& key, const Value& value, v_uint64 pHash, v_int32 pId)
+      : std::pair<Key, Value>(key, value)
+      , hash(pHash)
+      , id(pId)
+    {}
+
+    /**
+     * Precomputed hash of the key.
+     */
+    v_uint64 hash = 0;
+
+    /**
+     * Id of the interned key or `-1`.
+     */
+    v_int32 id = -1;
+
+  };
+
+private:
+
+  static v_uint64 hashKey(const Key& key) {
+    return std::hash<Key>{}(key);
+  }
+
+private:
+  Entry m_inline[static_cast<size_t>(InlineCapacity)];
+  std::vector<Entry> m_heap;
+  std::array<v_int32, static_cast<size_t>(KeyRegistry::SIZE)> m_firstById;
+  v_int32 m_size;
+  bool m_spilled;
+  mutable bool m_fullyInitialized;
+private:
+
+  Entry* entries() {
+    return m_spilled ? m_heap.data() : m_inline;
+  }
+
+  const Entry* entries() const {
+    return m_spilled ? m_heap.data() : m_inline;
+  }
+
+  const Entry* findById(v_int32 id) const {
+    auto index = m_firstById[static_cast<size_t>(id)];
+    return index >= 0 ? entries() + index : nullptr;
+  }
+
+  const Entry* find(const Key& key, v_uint64 hash, v_int32 id) const {
+    if(id >= 0) {
+      return findById(id);
+    }
+    auto data = entries();
+    for(v_int32 i = 0; i < m_size; i ++) {
+      const auto& entry = data[i];
+      if(entry.hash == hash && entry.first == key) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  void reindex() {
+    m_firstById.fill(-1);
+    auto data = entries();
+    for(v_int32 i = m_size - 1; i >= 0; i --) {
+      if(data[i].id >= 0) {
+        m_firstById[static_cast<size_t>(data[i].id)] = i;
+      }
+    }
+  }
+
+  void append(const Key& key, const Value& value, v_uint64 hash, v_int32 id) {
+
+    if(!m_spilled && m_size == InlineCapacity) {
+      m_heap.reserve(static_cast<size_t>(InlineCapacity) * 2);
+      for(v_int32 i = 0; i < m_size; i ++) {
+        m_heap.emplace_back(std::move(m_inline[i]));
+        m_inline[i] = Entry();
+      }
+      m_spilled = true;
+    }
+
+    if(m_spilled) {
+      m_heap.emplace_back(key, value, hash, id);
+    } else {
+      m_inline[m_size] = Entry(key, value, hash, id);
+    }
+
+    if(id >= 0 && m_firstById[static_cast<size_t>(id)] < 0) {
+      m_firstById[static_cast<size_t>(id)] = m_size;
+    }
+
+    m_size ++;
+    m_fullyInitialized = false;
+
+  }
+
+  bool insertIfNotExists(const Key& key, const Value& value, v_uint64 hash, v_int32 id) {
+    if(find(key, hash, id) == nullptr) {
+      append(key, value, hash, id);
+      return true;
+    }
+    return false;
+  }
+
+  bool insertOrReplace(const Key& key, const Value& value, v_uint64 hash, v_int32 id) {
+    bool replaced = erase(key, hash);
+    append(key, value, hash, id);
+    return replaced;
+  }
+
+  template<class T>
+  static T toMemoryLabel(const Entry* entry, bool capture) {
+    if(entry != nullptr) {
+      if(capture) {
+        entry->second.captureToOwnMemory();
+      }
+      const auto& label = entry->second;
+      return T(label.getMemoryHandle(), reinterpret_cast<const char*>(label.getData()), label.getSize());
+    }
+    return T(nullptr, nullptr, 0);
+  }
+
+  static String toString(const Entry* entry) {
+    if(entry != nullptr) {
+      entry->second.captureToOwnMemory();
+      return entry->second.getMemoryHandle();
+    }
+    return nullptr;
+  }
+
+  bool erase(const Key& key, v_uint64 hash) {
+
+    auto data = entries();
+    v_int32 newSize = 0;
+
+    for(v_int32 i = 0; i < m_size; i ++) {
+      if(data[i].hash == hash && data[i].first == key) {
+        continue;
+      }
+      if(newSize != i) {
+        data[newSize] = std::move(data[i]);
+      }
+      newSize ++;
+    }
+
+    if(newSize == m_size) {
+      return false;
+    }
+
+    if(m_spilled) {
+      m_heap.resize(static_cast<size_t>(newSize));
+    } else {
+      for(v_int32 i = newSize; i < m_size; i ++) {
+        m_inline[i] = Entry();
+      }
+    }
+
+    m_size = newSize;
+    reindex();
+    return true;
+
+  }
+
+  void moveFrom(LazyStringFlatMultimap& other) {
+
+    m_size = other.m_size;
+    m_spilled = other.m_spilled;
+    m_fullyInitialized = other.m_fullyInitialized;
+    m_firstById = other.m_firstById;
+
+    if(m_spilled) {
+      m_heap = std::move(other.m_heap);
+    } else {
+      m_heap.clear();
+      for(v_int32 i = 0; i < m_size; i ++) {
+        m_inline[i] = std::move(other.m_inline[i]);
+      }
+    }
+
+    other.m_heap.clear();
+    other.m_size = 0;
+    other.m_spilled = false;
+    other.m_fullyInitialized = true;
+    other.m_firstById.fill(-1);
+
+  }
+
+public:
+
+  /**
+   * Constructor.
+   */
+  LazyStringFlatMultimap()
+    : m_size(0)
+    , m_spilled(false)
+    , m_fullyInitialized(true)
+  {
+    m_firstById.fill(-1);
+  }
+
+  /**
+   * Copy-constructor.
+   * @param other
+   */
+  LazyStringFlatMultimap(const LazyStringFlatMultimap& other) = default;
+
+  /**
+   * Move constructor.
+   * @param other
+   */
+  LazyStringFlatMultimap(LazyStringFlatMultimap&& other) noexcept
+    : m_size(0)
+    , m_spilled(false)
+    , m_fullyInitialized(true)
+  {
+    moveFrom(other);
+  }
+
+  LazyStringFlatMultimap& operator = (const LazyStringFlatMultimap& other) = default;
+
+  LazyStringFlatMultimap& operator = (LazyStringFlatMultimap&& other) noexcept {
+    if(this != &other) {
+      for(v_int32 i = 0; i < (m_spilled ? 0 : m_size); i ++) {
+        m_inline[i] = Entry();
+      }
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  /**
+   * Put value to map.
+   * @param key
+   * @param value
+   */
+  void put(const Key& key, const Value& value) {
+    auto hash = hashKey(key);
+    append(key, value, hash, KeyRegistry::getId(key, hash));
+  }
+
+  /**
+   * Put value to map.
+   * @param id - id of the interned key.
+   * @param value
+   */
+  void put(KeyId id, const Value& value) {
+    append(KeyRegistry::getKey(id), value, KeyRegistry::getHash(id), static_cast<v_int32>(id));
+  }
+
+  /**
+   * Put value to map. Same as &l:LazyStringFlatMultimap::put ();.
+   * @param key
+   * @param value
+   */
+  void put_LockFree(const Key& key, const Value& value) {
+    put(key, value);
+  }
+
+  /**
+   * Put value to map if not already exists.
+   * @param key
+   * @param value
+   * @return
+   */
+  bool putIfNotExists(const Key& key, const Value& value) {
+    auto hash = hashKey(key);
+    return insertIfNotExists(key, value, hash, KeyRegistry::getId(key, hash));
+  }
+
+  /**
+   * Put value to map if not already exists.
+   * @param id - id of the interned key.
+   * @param value
+   * @return
+   */
+  bool putIfNotExists(KeyId id, const Value& value) {
+    return insertIfNotExists(KeyRegistry::getKey(id), value, KeyRegistry::getHash(id), static_cast<v_int32>(id));
+  }
+
+  /**
+   * Put value to map if not already exists. Same as &l:LazyStringFlatMultimap::putIfNotExists ();.
+   * @param key
+   * @param value
+   * @return
+   */
+  bool putIfNotExists_LockFree(const Key& key, const Value& value) {
+    return putIfNotExists(key, value);
+  }
+
+  /**
+   * Erases all occurrences of key and replaces them with a new entry
+   * @param key
+   * @param value
+   * @return - `true` if an entry was replaced, `false` if entry was only inserted.
+   */
+  bool putOrReplace(const Key& key, const Value& value) {
+    auto hash = hashKey(key);
+    return insertOrReplace(key, value, hash, KeyRegistry::getId(key, hash));
+  }
+
+  /**
+   * Erases all occurrences of key and replaces them with a new entry
+   * @param id - id of the interned key.
+   * @param value
+   * @return - `true` if an entry was replaced, `false` if entry was only inserted.
+   */
+  bool putOrReplace(KeyId id, const Value& value) {
+    return insertOrReplace(KeyRegistry::getKey(id), value, KeyRegistry::getHash(id), static_cast<v_int32>(id));
+  }
+
+  /**
+   * Erases all occurrences of key and replaces them with a new entry. Same as &l:LazyStringFlatMultimap::putOrReplace ();.
+   * @param key
+   * @param value
+   * @return - `true` if an entry was replaced, `false` if entry was only inserted.
+   */
+  bool putOrReplace_LockFree(const Key& key, const Value& value) {
+    return putOrReplace(key, value);
+  }
+
+  /**
+   * Get value as &id:oatpp::String;. If there are several entries for the key the first one is returned.
+   * @param key
+   * @return
+   */
+  String get(const Key& key) const {
+    auto hash = hashKey(key);
+    return toString(find(key, hash, KeyRegistry::getId(key, hash)));
+  }
+
+  /**
+   * Get value as &id:oatpp::String;. If there are several entries for the key the first one is returned.
+   * @param id - id of the interned key.
+   * @return
+   */
+  String get(KeyId id) const {
+    return toString(findById(static_cast<v_int32>(id)));
+  }
+
+  /**
+   * Get value as a memory label.
+   * @tparam T - one of: &id:oatpp::data::share::MemoryLabel;, &id:oatpp::data::share::StringKeyLabel;, &id:oatpp::data::share::StringKeyLabelCI;.
+   * @param key
+   * @return
+   */
+  template<class T>
+  T getAsMemoryLabel(const Key& key) const {
+    auto hash = hashKey(key);
+    return toMemoryLabel<T>(find(key, hash, KeyRegistry::getId(key, hash)), true);
+  }
+
+  /**
+   * Get value as a memory label.
+   * @tparam T - one of: &id:oatpp::data::share::MemoryLabel;, &id:oatpp::data::share::StringKeyLabel;, &id:oatpp::data::share::StringKeyLabelCI;.
+   * @param id - id of the interned key.
+   * @return
+   */
+  template<class T>
+  T getAsMemoryLabel(KeyId id) const {
+    return toMemoryLabel<T>(findById(static_cast<v_int32>(id)), true);
+  }
+
+  /**
+   * Get value as a memory label without allocating memory for value.
+   * @tparam T - one of: &id:oatpp::data::share::MemoryLabel;, &id:oatpp::data::share::StringKeyLabel;, &id:oatpp::data::share::StringKeyLabelCI;.
+   * @param key
+   * @return
+   */
+  template<class T>
+  T getAsMemoryLabel_Unsafe(const Key& key) const {
+    auto hash = hashKey(key);
+    return toMemoryLabel<T>(find(key, hash, KeyRegistry::getId(key, hash)), false);
+  }
+
+  /**
+   * Get value as a memory label without allocating memory for value.
+   * @tparam T - one of: &id:oatpp::data::share::MemoryLabel;, &id:oatpp::data::share::StringKeyLabel;, &id:oatpp::data::share::StringKeyLabelCI;.
+   * @param id - id of the interned key.
+   * @return
+   */
+  template<class T>
+  T getAsMemoryLabel_Unsafe(KeyId id) const {
+    return toMemoryLabel<T>(findById(static_cast<v_int32>(id)), false);
+  }
+
+  /**
+   * Get all entries. Keys and values are captured to own memory. <br>
+   * The returned map is iterable - `for(auto& pair : map.getAll()) {...}`.
+   * @return
+   */
+  const LazyStringFlatMultimap& getAll() const {
+
+    if(!m_fullyInitialized) {
+      auto data = entries();
+      for(v_int32 i = 0; i < m_size; i ++) {
+        data[i].first.captureToOwnMemory();
+        data[i].second.captureToOwnMemory();
+      }
+      m_fullyInitialized = true;
+    }
+
+    return *this;
+
+  }
+
+  /**
+   * Get all entries without allocating memory for those keys/values.
+   * @return
+   */
+  const LazyStringFlatMultimap& getAll_Unsafe() const {
+    return *this;
+  }
+
+  /**
+   * Iterator to the first entry.
+   * @return
+   */
+  const Entry* begin() const {
+    return entries();
+  }
+
+  /**
+   * Iterator past the last entry.
+   * @return
+   */
+  const Entry* end() const {
+    return entries() + m_size;
+  }
+
+  /**
+   * Get number of entries in the map.
+   * @return
+   */
+  v_int32 getSize() const {
+    return m_size;
+  }
+
+};
+
+}}}
+
+#endif //oatpp_data_share_LazyStringFlatMap_hpp
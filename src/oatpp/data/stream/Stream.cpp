@@ -25,11 +25,22 @@
 #include "./Stream.hpp"
 #include "oatpp/utils/Conversion.hpp"
 
+#include <algorithm>
+
 namespace oatpp { namespace data{ namespace stream {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // WriteCallback
 
+v_io_size WriteCallback::writeVector(const data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action) {
+  for(v_int32 i = 0; i < count; i ++) {
+    if(buffers[i].bytesLeft > 0) {
+      return write(buffers[i].currBufferPtr, buffers[i].bytesLeft, action);
+    }
+  }
+  return 0;
+}
+
 v_io_size WriteCallback::write(data::buffer::InlineWriteData& inlineData, async::Action& action) {
   auto res = write(inlineData.currBufferPtr, inlineData.bytesLeft, action);
   if(res > 0) {
@@ -38,6 +49,26 @@ v_io_size WriteCallback::write(data::buffer::InlineWriteData& inlineData, async:
   return res;
 }
 
+v_io_size WriteCallback::write(data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action) {
+
+  if(count == 1) {
+    return write(buffers[0], action);
+  }
+
+  auto res = writeVector(buffers, count, action);
+
+  /* distribute written bytes over the buffers */
+  v_io_size left = res;
+  for(v_int32 i = 0; i < count && left > 0; i ++) {
+    auto amount = std::min<v_io_size>(left, buffers[i].bytesLeft);
+    buffers[i].inc(amount);
+    left -= amount;
+  }
+
+  return res;
+
+}
+
 v_io_size WriteCallback::writeSimple(const void *data, v_buff_size count) {
   async::Action action;
   auto res = write(data, count, action);
@@ -49,10 +80,21 @@ v_io_size WriteCallback::writeSimple(const void *data, v_buff_size count) {
 }
 
 v_io_size WriteCallback::writeExactSizeDataSimple(data::buffer::InlineWriteData& inlineData) {
-  auto initialCount = inlineData.bytesLeft;
-  while(inlineData.bytesLeft > 0) {
+  return writeExactSizeDataSimple(&inlineData, 1);
+}
+
+v_io_size WriteCallback::writeExactSizeDataSimple(data::buffer::InlineWriteData* buffers, v_int32 count) {
+  v_io_size result = 0;
+  while(true) {
+    while(count > 0 && buffers->bytesLeft == 0) {
+      buffers ++;
+      count --;
+    }
+    if(count == 0) {
+      break;
+    }
     async::Action action;
-    auto res = write(inlineData, action);
+    auto res = write(buffers, count, action);
     if(!action.isNone()) {
       OATPP_LOGE("[oatpp::data::stream::WriteCallback::writeExactSizeDataSimple()]", "Error. writeExactSizeDataSimple() is called on a stream in Async mode.")
       throw std::runtime_error("[oatpp::data::stream::WriteCallback::writeExactSizeDataSimple()]: Error. writeExactSizeDataSimple() is called on a stream in Async mode.");
@@ -60,8 +102,11 @@ v_io_size WriteCallback::writeExactSizeDataSimple(data::buffer::InlineWriteData&
     if(res == IOError::BROKEN_PIPE || res == IOError::ZERO_VALUE) {
       break;
     }
+    if(res > 0) {
+      result += res;
+    }
   }
-  return initialCount - inlineData.bytesLeft;
+  return result;
 }
 
 v_io_size WriteCallback::writeExactSizeDataSimple(const void *data, v_buff_size count) {
@@ -70,11 +115,20 @@ v_io_size WriteCallback::writeExactSizeDataSimple(const void *data, v_buff_size
 }
 
 async::Action WriteCallback::writeExactSizeDataAsyncInline(data::buffer::InlineWriteData& inlineData, async::Action&& nextAction) {
+  return writeExactSizeDataAsyncInline(&inlineData, 1, std::forward<async::Action>(nextAction));
+}
 
-  if(inlineData.bytesLeft > 0) {
+async::Action WriteCallback::writeExactSizeDataAsyncInline(data::buffer::InlineWriteData* buffers, v_int32 count, async::Action&& nextAction) {
+
+  while(count > 0 && buffers->bytesLeft == 0) {
+    buffers ++;
+    count --;
+  }
+
+  if(count > 0) {
 
     async::Action action;
-    auto res = write(inlineData, action);
+    auto res = write(buffers, count, action);
 
     if (!action.isNone()) {
       return action;
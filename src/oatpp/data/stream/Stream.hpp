@@ -212,16 +212,34 @@ public:
    */
   virtual v_io_size write(const void *data, v_buff_size count, async::Action& action) = 0;
 
+  /**
+   * Vectored write operation callback - write data of several buffers in one call (scatter-gather). <br>
+   * Default implementation writes the first non-empty buffer with &l:WriteCallback::write (...);. <br>
+   * Override it if the underlying transport supports vectored writes.
+   * @param buffers - array of &id:oatpp::data::buffer::InlineWriteData;. Buffers are NOT modified.
+   * @param count - number of buffers in the array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written - in total for all buffers. 0 - to indicate end-of-file.
+   */
+  virtual v_io_size writeVector(const data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action);
+
   v_io_size write(data::buffer::InlineWriteData& inlineData, async::Action& action);
 
+  v_io_size write(data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action);
+
   v_io_size writeSimple(const void *data, v_buff_size count);
 
   v_io_size writeExactSizeDataSimple(data::buffer::InlineWriteData& inlineData);
 
   v_io_size writeExactSizeDataSimple(const void *data, v_buff_size count);
 
+  v_io_size writeExactSizeDataSimple(data::buffer::InlineWriteData* buffers, v_int32 count);
+
   async::Action writeExactSizeDataAsyncInline(data::buffer::InlineWriteData& inlineData, async::Action&& nextAction);
 
+  async::Action writeExactSizeDataAsyncInline(data::buffer::InlineWriteData* buffers, v_int32 count, async::Action&& nextAction);
+
   async::CoroutineStarter writeExactSizeDataAsync(const void* data, v_buff_size size);
 
   /**
@@ -24,6 +24,9 @@
 
 #include "./Object.hpp"
 
+#include <cstring>
+#include <mutex>
+
 namespace oatpp { namespace data { namespace type {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,15 +59,97 @@ void* BaseObject::getBasePointer() const {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // BaseObject::Properties
 
+v_uint64 BaseObject::Properties::hashName(const char* name, v_buff_size nameSize) {
+  /* FNV-1a */
+  v_uint64 result = 14695981039346656037ULL;
+  for(v_buff_size i = 0; i < nameSize; i ++) {
+    result ^= static_cast<v_uint8>(name[i]);
+    result *= 1099511628211ULL;
+  }
+  return result;
+}
+
+void BaseObject::Properties::buildIndex() {
+
+  /* keep load factor <= 0.5 so that most of the lookups hit the first probed slot */
+  v_uint64 capacity = 8;
+  while(capacity < m_list.size() * 2) {
+    capacity <<= 1;
+  }
+
+  m_index.assign(capacity, IndexEntry{0, 0, nullptr});
+  m_indexMask = capacity - 1;
+
+  /* parent's properties go first - property of the same name declared later takes the slot */
+  for(auto property : m_list) {
+    auto nameSize = static_cast<v_buff_size>(std::strlen(property->name));
+    auto hash = hashName(property->name, nameSize);
+    auto slot = hash & m_indexMask;
+    while(m_index[slot].property != nullptr) {
+      const auto& entry = m_index[slot];
+      if(entry.hash == hash && entry.nameSize == nameSize && std::memcmp(entry.property->name, property->name, static_cast<size_t>(nameSize)) == 0) {
+        break;
+      }
+      slot = (slot + 1) & m_indexMask;
+    }
+    m_index[slot] = IndexEntry{hash, nameSize, property};
+  }
+
+}
+
+BaseObject::Property* BaseObject::Properties::find(const char* name, v_buff_size nameSize) const {
+
+  if(m_index.empty()) {
+    for(auto it = m_list.rbegin(); it != m_list.rend(); ++ it) {
+      auto property = *it;
+      if(std::strncmp(property->name, name, static_cast<size_t>(nameSize)) == 0 && property->name[nameSize] == 0) {
+        return property;
+      }
+    }
+    return nullptr;
+  }
+
+  auto hash = hashName(name, nameSize);
+  auto slot = hash & m_indexMask;
+
+  while(true) {
+    const auto& entry = m_index[slot];
+    if(entry.property == nullptr) {
+      return nullptr;
+    }
+    if(entry.hash == hash && entry.nameSize == nameSize && std::memcmp(entry.property->name, name, static_cast<size_t>(nameSize)) == 0) {
+      return entry.property;
+    }
+    slot = (slot + 1) & m_indexMask;
+  }
+
+}
+
+const std::unordered_map<std::string, BaseObject::Property*>& BaseObject::Properties::getMap() const {
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+  if(!m_mapBuilt) {
+    for(auto property : m_list) {
+      m_map[property->name] = property;
+    }
+    m_mapBuilt = true;
+  }
+  return m_map;
+}
+
 BaseObject::Property* BaseObject::Properties::pushBack(Property* property) {
-  m_map.insert({property->name, property});
   m_list.push_back(property);
+  m_index.clear();
+  m_map.clear();
+  m_mapBuilt = false;
   return property;
 }
 
 void BaseObject::Properties::pushFrontAll(Properties* properties) {
-  m_map.insert(properties->m_map.begin(), properties->m_map.end());
   m_list.insert(m_list.begin(), properties->m_list.begin(), properties->m_list.end());
+  m_index.clear();
+  m_map.clear();
+  m_mapBuilt = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
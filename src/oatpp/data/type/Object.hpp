@@ -171,8 +171,25 @@ public:
    */
   class Properties {
   private:
-    std::unordered_map<std::string, Property*> m_map;
-    std::list<Property*> m_list;
+
+    /*
+     * Entry of the flat open-addressing lookup index.
+     */
+    struct IndexEntry {
+      v_uint64 hash;
+      v_buff_size nameSize;
+      Property* property;
+    };
+
+  private:
+    static v_uint64 hashName(const char* name, v_buff_size nameSize);
+  private:
+    std::vector<Property*> m_list;
+    std::vector<IndexEntry> m_index;
+    v_uint64 m_indexMask = 0;
+    /* built on the first call to getMap() only */
+    mutable std::unordered_map<std::string, Property*> m_map;
+    mutable bool m_mapBuilt = false;
   public:
 
     /**
@@ -188,21 +205,45 @@ public:
     void pushFrontAll(Properties* properties);
 
     /**
-     * Get properties as unordered map for random access.
+     * Build lookup index for &l:Properties::find ();. <br>
+     * Called once all properties are added - after the fields of the type and the fields of its parent.
+     * Until then &l:Properties::find (); scans the list.
+     */
+    void buildIndex();
+
+    /**
+     * Get properties as unordered map for random access. <br>
+     * *Note: the map is built on the first call. Use &l:Properties::find (); for lookups.*
      * @return reference to std::unordered_map of std::string to &id:oatpp::data::type::BaseObject::Property;*.
      */
-    const std::unordered_map<std::string, Property*>& getMap() const {
-      return m_map;
-    }
+    const std::unordered_map<std::string, Property*>& getMap() const;
 
     /**
-     * Get properties in ordered way.
-     * @return std::list of &id:oatpp::data::type::BaseObject::Property;*.
+     * Get properties in ordered way. <br>
+     * *Note: returns std::vector - it used to return std::list.*
+     * @return std::vector of &id:oatpp::data::type::BaseObject::Property;*.
      */
-    const std::list<Property*>& getList() const {
+    const std::vector<Property*>& getList() const {
       return m_list;
     }
 
+    /**
+     * Find property by name. Doesn't allocate.
+     * @param name - pointer to property name. Doesn't have to be null-terminated.
+     * @param nameSize - size of the name.
+     * @return - &id:oatpp::data::type::BaseObject::Property;* or `nullptr` if not found.
+     */
+    Property* find(const char* name, v_buff_size nameSize) const;
+
+    /**
+     * Find property by name. Doesn't allocate.
+     * @param name - property name.
+     * @return - &id:oatpp::data::type::BaseObject::Property;* or `nullptr` if not found.
+     */
+    Property* find(const std::string& name) const {
+      return find(name.data(), static_cast<v_buff_size>(name.size()));
+    }
+
   };
 
 private:
@@ -282,7 +323,9 @@ namespace __class {
       /* extend parent properties */
       T::Z__CLASS_EXTEND(T::Z__CLASS::Z__CLASS_GET_FIELDS_MAP(), T::Z__CLASS_EXTENDED::Z__CLASS_GET_FIELDS_MAP());
 
-      return T::Z__CLASS::Z__CLASS_GET_FIELDS_MAP();
+      auto properties = T::Z__CLASS::Z__CLASS_GET_FIELDS_MAP();
+      properties->buildIndex();
+      return properties;
 
     }
 
@@ -392,7 +435,12 @@ public:
     return dispatcher->getProperties()->getMap();
   }
 
-  static const std::list<BaseObject::Property*>& getPropertiesList() {
+  /**
+   * Get properties in ordered way. <br>
+   * *Note: returns std::vector - it used to return std::list.*
+   * @return std::vector of &id:oatpp::data::type::BaseObject::Property;*.
+   */
+  static const std::vector<BaseObject::Property*>& getPropertiesList() {
     auto dispatcher = static_cast<const __class::AbstractObject::PolymorphicDispatcher*>(
       __class::Object<ObjT>::getType()->polymorphicDispatcher
     );
@@ -407,7 +455,14 @@ public:
   }
 
   ObjectWrapper<void>& operator[](const std::string& propertyName) {
-    return getPropertiesMap().at(propertyName)->getAsRef(this->m_ptr.get());
+    auto dispatcher = static_cast<const __class::AbstractObject::PolymorphicDispatcher*>(
+      __class::Object<ObjT>::getType()->polymorphicDispatcher
+    );
+    auto property = dispatcher->getProperties()->find(propertyName);
+    if(property == nullptr) {
+      throw std::out_of_range("[oatpp::data::type::DTOWrapper::operator[]]: Error. No such property '" + propertyName + "'.");
+    }
+    return property->getAsRef(this->m_ptr.get());
   }
 
 };
@@ -0,0 +1,501 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ObjectDeserializer.hpp"
+
+#include "oatpp/utils/Conversion.hpp"
+
+namespace oatpp { namespace json {
+
+ObjectDeserializer::ObjectDeserializer() {
+
+  m_methods.resize(static_cast<size_t>(data::type::ClassId::getClassCount()), nullptr);
+
+  setDeserializerMethod(data::type::__class::String::CLASS_ID, &ObjectDeserializer::deserializeString);
+
+  setDeserializerMethod(data::type::__class::Tree::CLASS_ID, &ObjectDeserializer::deserializeTree);
+  setDeserializerMethod(data::type::__class::Any::CLASS_ID, &ObjectDeserializer::deserializeAny);
+
+  setDeserializerMethod(data::type::__class::Int8::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::Int8>);
+  setDeserializerMethod(data::type::__class::UInt8::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::UInt8>);
+
+  setDeserializerMethod(data::type::__class::Int16::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::Int16>);
+  setDeserializerMethod(data::type::__class::UInt16::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::UInt16>);
+
+  setDeserializerMethod(data::type::__class::Int32::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::Int32>);
+  setDeserializerMethod(data::type::__class::UInt32::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::UInt32>);
+
+  setDeserializerMethod(data::type::__class::Int64::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::Int64>);
+  setDeserializerMethod(data::type::__class::UInt64::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::UInt64>);
+
+  setDeserializerMethod(data::type::__class::Float32::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::Float32>);
+  setDeserializerMethod(data::type::__class::Float64::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::Float64>);
+  setDeserializerMethod(data::type::__class::Boolean::CLASS_ID, &ObjectDeserializer::deserializePrimitive<oatpp::Boolean>);
+
+  setDeserializerMethod(data::type::__class::AbstractObject::CLASS_ID, &ObjectDeserializer::deserializeObject);
+  setDeserializerMethod(data::type::__class::AbstractEnum::CLASS_ID, &ObjectDeserializer::deserializeEnum);
+
+  setDeserializerMethod(data::type::__class::AbstractVector::CLASS_ID, &ObjectDeserializer::deserializeCollection);
+  setDeserializerMethod(data::type::__class::AbstractList::CLASS_ID, &ObjectDeserializer::deserializeCollection);
+  setDeserializerMethod(data::type::__class::AbstractUnorderedSet::CLASS_ID, &ObjectDeserializer::deserializeCollection);
+
+  setDeserializerMethod(data::type::__class::AbstractPairList::CLASS_ID, &ObjectDeserializer::deserializeMap);
+  setDeserializerMethod(data::type::__class::AbstractUnorderedMap::CLASS_ID, &ObjectDeserializer::deserializeMap);
+
+}
+
+void ObjectDeserializer::setDeserializerMethod(const data::type::ClassId& classId, DeserializerMethod method) {
+  const auto id = static_cast<v_uint32>(classId.id);
+  if(id >= m_methods.size()) {
+    m_methods.resize(id + 1, nullptr);
+  }
+  m_methods[id] = method;
+}
+
+oatpp::Void ObjectDeserializer::deserialize(State& state, const Type* type) const {
+
+  state.caret->skipBlankChars();
+
+  auto id = static_cast<v_uint32>(type->classId.id);
+  auto& method = m_methods[id];
+  if(method) {
+    return (*method)(this, state, type);
+  } else {
+
+    auto* interpretation = type->findInterpretation(state.mapperConfig->enabledInterpretations);
+    if(interpretation) {
+      return interpretation->fromInterpretation(deserialize(state, interpretation->getInterpretationType()));
+    }
+
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserialize()]: "
+                          "Error. No deserialize method for type '" + std::string(type->classId.name) + "'");
+    return nullptr;
+
+  }
+
+}
+
+bool ObjectDeserializer::isNullAtCaret(State& state) {
+  return state.caret->isAtText("null", true);
+}
+
+bool ObjectDeserializer::deserializePrimitiveNode(State& state, data::mapping::Tree& node) {
+
+  auto c = *state.caret->getCurrData();
+  switch (c) {
+    case 'n':
+    case 't':
+    case 'f':
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+      deserializeToTree(state, node);
+      return state.errorStack.empty();
+    default:
+      return false;
+  }
+
+}
+
+void ObjectDeserializer::deserializeToTree(State& state, data::mapping::Tree& tree) {
+
+  Deserializer::State treeState;
+  treeState.config = state.config;
+  treeState.tree = &tree;
+  treeState.caret = state.caret;
+
+  Deserializer::deserialize(treeState);
+
+  if(!treeState.errorStack.empty()) {
+    state.errorStack.splice(treeState.errorStack);
+  }
+
+}
+
+oatpp::Void ObjectDeserializer::deserializeString(const ObjectDeserializer* deserializer, State& state, const Type* type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(isNullAtCaret(state)) {
+    return oatpp::Void(String::Class::getType());
+  }
+
+  if(state.caret->isAtChar('"')) {
+    auto result = Utils::parseString(*state.caret);
+    if(state.caret->hasError()) {
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeString()]: " + oatpp::String(state.caret->getErrorMessage()));
+      return nullptr;
+    }
+    return result;
+  }
+
+  state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeString()]: Value is NOT a STRING");
+  return nullptr;
+
+}
+
+oatpp::Void ObjectDeserializer::deserializeTree(const ObjectDeserializer* deserializer, State& state, const Type* type) {
+
+  (void) deserializer;
+  (void) type;
+
+  auto tree = std::make_shared<data::mapping::Tree>();
+  deserializeToTree(state, *tree);
+  if(!state.errorStack.empty()) {
+    return nullptr;
+  }
+  return oatpp::Tree(tree, oatpp::Tree::Class::getType());
+
+}
+
+oatpp::Void ObjectDeserializer::deserializeAny(const ObjectDeserializer* deserializer, State& state, const Type* type) {
+
+  (void) type;
+
+  if(isNullAtCaret(state)) {
+    return oatpp::Void(Any::Class::getType());
+  }
+
+  const Type* valueType;
+
+  auto c = *state.caret->getCurrData();
+  switch (c) {
+    case '{': valueType = Fields<oatpp::Any>::Class::getType(); break;
+    case '[': valueType = Vector<oatpp::Any>::Class::getType(); break;
+    case '"': valueType = String::Class::getType(); break;
+    case 't':
+    case 'f': valueType = Boolean::Class::getType(); break;
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+      if(Utils::findDecimalSeparatorInCurrentNumber(*state.caret)) {
+        valueType = Float64::Class::getType();
+      } else {
+        valueType = Int64::Class::getType();
+      }
+      break;
+    default:
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeAny()]: Unknown character.");
+      return nullptr;
+  }
+
+  auto value = deserializer->deserialize(state, valueType);
+  if(!state.errorStack.empty()) {
+    return nullptr;
+  }
+
+  auto anyHandle = std::make_shared<data::type::AnyHandle>(value.getPtr(), value.getValueType());
+  return oatpp::Void(anyHandle, Any::Class::getType());
+
+}
+
+oatpp::Void ObjectDeserializer::deserializeEnum(const ObjectDeserializer* deserializer, State& state, const Type* type) {
+
+  auto polymorphicDispatcher = static_cast<const data::type::__class::AbstractEnum::PolymorphicDispatcher*>(
+    type->polymorphicDispatcher
+  );
+
+  data::type::EnumInterpreterError e = data::type::EnumInterpreterError::OK;
+  const auto& value = deserializer->deserialize(state, polymorphicDispatcher->getInterpretationType());
+  if(!state.errorStack.empty()) {
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeEnum()]");
+    return nullptr;
+  }
+  const auto& result = polymorphicDispatcher->fromInterpretation(value, e);
+
+  if(e == data::type::EnumInterpreterError::OK) {
+    return result;
+  }
+
+  switch(e) {
+    case data::type::EnumInterpreterError::CONSTRAINT_NOT_NULL:
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeEnum()]: Error. Enum constraint violated - 'NotNull'.");
+      break;
+    case data::type::EnumInterpreterError::OK:
+    case data::type::EnumInterpreterError::TYPE_MISMATCH_ENUM:
+    case data::type::EnumInterpreterError::TYPE_MISMATCH_ENUM_VALUE:
+    case data::type::EnumInterpreterError::ENTRY_NOT_FOUND:
+    default:
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeEnum()]: Error. Can't deserialize Enum.");
+  }
+
+  return nullptr;
+
+}
+
+oatpp::Void ObjectDeserializer::deserializeCollection(const ObjectDeserializer* deserializer, State& state, const Type* type) {
+
+  if(isNullAtCaret(state)) {
+    return oatpp::Void(type);
+  }
+
+  if(!state.caret->canContinueAtChar('[', 1)) {
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeCollection()]: '[' expected");
+    return nullptr;
+  }
+
+  auto dispatcher = static_cast<const data::type::__class::Collection::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto collection = dispatcher->createObject();
+
+  auto itemType = dispatcher->getItemType();
+
+  state.caret->skipBlankChars();
+
+  v_uint64 index = 0;
+
+  while(!state.caret->isAtChar(']') && state.caret->canContinue()) {
+
+    auto item = deserializer->deserialize(state, itemType);
+
+    if(!state.errorStack.empty()) {
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeCollection()]: index=" + utils::Conversion::uint64ToStr(index));
+      return nullptr;
+    }
+
+    dispatcher->addItem(collection, item);
+
+    state.caret->skipBlankChars();
+    state.caret->canContinueAtChar(',', 1);
+    state.caret->skipBlankChars();
+
+    index ++;
+
+  }
+
+  if(!state.caret->canContinueAtChar(']', 1)) {
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeCollection()]: ']' expected");
+    return nullptr;
+  }
+
+  return collection;
+
+}
+
+oatpp::Void ObjectDeserializer::deserializeMap(const ObjectDeserializer* deserializer, State& state, const Type* type) {
+
+  if(isNullAtCaret(state)) {
+    return oatpp::Void(type);
+  }
+
+  if(!state.caret->canContinueAtChar('{', 1)) {
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeMap()]: '{' expected");
+    return nullptr;
+  }
+
+  auto dispatcher = static_cast<const data::type::__class::Map::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto map = dispatcher->createObject();
+
+  auto keyType = dispatcher->getKeyType();
+  if(keyType->classId != oatpp::String::Class::CLASS_ID){
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeMap()]: Invalid map key. Key should be String");
+    return nullptr;
+  }
+  auto valueType = dispatcher->getValueType();
+
+  state.caret->skipBlankChars();
+
+  while (!state.caret->isAtChar('}') && state.caret->canContinue()) {
+
+    auto key = Utils::parseString(*state.caret);
+    if(state.caret->hasError()){
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeMap()]: Item key name expected");
+      return nullptr;
+    }
+
+    state.caret->skipBlankChars();
+    if(!state.caret->canContinueAtChar(':', 1)){
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeMap()]: ':' expected");
+      return nullptr;
+    }
+
+    auto item = deserializer->deserialize(state, valueType);
+
+    if(!state.errorStack.empty()) {
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeMap()]: key='" + key + "'");
+      return nullptr;
+    }
+
+    dispatcher->addItem(map, key, item);
+
+    state.caret->skipBlankChars();
+    state.caret->canContinueAtChar(',', 1);
+    state.caret->skipBlankChars();
+
+  }
+
+  if(!state.caret->canContinueAtChar('}', 1)) {
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeMap()]: '}' expected");
+    return nullptr;
+  }
+
+  return map;
+
+}
+
+oatpp::Void ObjectDeserializer::deserializeObject(const ObjectDeserializer* deserializer, State& state, const Type* type) {
+
+  if(isNullAtCaret(state)) {
+    return oatpp::Void(type);
+  }
+
+  if(!state.caret->canContinueAtChar('{', 1)) {
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: '{' expected");
+    return nullptr;
+  }
+
+  auto dispatcher = static_cast<const oatpp::data::type::__class::AbstractObject::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto object = dispatcher->createObject();
+  auto properties = dispatcher->getProperties();
+
+  /* polymorphic fields depend on values of other fields - parse them to Tree and map when the object is complete */
+  std::vector<std::pair<oatpp::BaseObject::Property*, data::mapping::Tree>> polymorphs;
+
+  state.caret->skipBlankChars();
+
+  while (!state.caret->isAtChar('}') && state.caret->canContinue()) {
+
+    /* std::string here - short keys fit into SSO buffer and don't allocate */
+    auto key = Utils::parseStringToStdString(*state.caret);
+    if(state.caret->hasError()){
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: Item key name expected");
+      return nullptr;
+    }
+
+    state.caret->skipBlankChars();
+    if(!state.caret->canContinueAtChar(':', 1)){
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: ':' expected");
+      return nullptr;
+    }
+
+    state.caret->skipBlankChars();
+
+    auto field = properties->find(key);
+    if(field){
+
+      if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
+
+        polymorphs.emplace_back(field, data::mapping::Tree());
+        deserializeToTree(state, polymorphs.back().second);
+
+        if(!state.errorStack.empty()) {
+          state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: field='" + oatpp::String(key) + "'");
+          return nullptr;
+        }
+
+      } else {
+
+        auto value = deserializer->deserialize(state, field->type);
+
+        if(!state.errorStack.empty()) {
+          state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: field='" + oatpp::String(key) + "'");
+          return nullptr;
+        }
+
+        if(field->info.required && value == nullptr) {
+          state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: Error. " +
+                                oatpp::String(type->nameQualifier) + "::" +
+                                oatpp::String(field->name) + " is required!");
+          return nullptr;
+        }
+        field->set(static_cast<oatpp::BaseObject *>(object.get()), value);
+
+      }
+
+    } else if (!state.mapperConfig->allowUnknownFields) {
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: Error. Unknown field '" + oatpp::String(key) + "'");
+      return nullptr;
+    } else {
+
+      /* skip value of unknown field */
+      data::mapping::Tree skipped;
+      deserializeToTree(state, skipped);
+
+      if(!state.errorStack.empty()) {
+        state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: field='" + oatpp::String(key) + "'");
+        return nullptr;
+      }
+
+    }
+
+    state.caret->skipBlankChars();
+    state.caret->canContinueAtChar(',', 1);
+    state.caret->skipBlankChars();
+
+  }
+
+  if(!state.caret->canContinueAtChar('}', 1)) {
+    state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: '}' expected");
+    return nullptr;
+  }
+
+  for(auto& p : polymorphs) {
+
+    auto selectedType = p.first->info.typeSelector->selectType(static_cast<oatpp::BaseObject *>(object.get()));
+
+    data::mapping::TreeToObjectMapper::State nestedState;
+    nestedState.tree = &p.second;
+    nestedState.config = state.mapperConfig;
+
+    auto value = deserializer->m_treeToObjectMapper.map(nestedState, selectedType);
+
+    if(!nestedState.errorStack.empty()) {
+      state.errorStack.splice(nestedState.errorStack);
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: field='" + oatpp::String(p.first->name) + "'");
+      return nullptr;
+    }
+
+    if(p.first->info.required && value == nullptr) {
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializeObject()]: Error. " +
+                            oatpp::String(type->nameQualifier) + "::" +
+                            oatpp::String(p.first->name) + " is required!");
+      return nullptr;
+    }
+
+    oatpp::Any any(value);
+    p.first->set(static_cast<oatpp::BaseObject *>(object.get()), oatpp::Void(any.getPtr(), p.first->type));
+
+  }
+
+  return object;
+
+}
+
+}}
@@ -0,0 +1,113 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_json_ObjectDeserializer_hpp
+#define oatpp_json_ObjectDeserializer_hpp
+
+#include "./Deserializer.hpp"
+
+#include "oatpp/data/mapping/TreeToObjectMapper.hpp"
+
+namespace oatpp { namespace json {
+
+/**
+ * Single-pass Json Deserializer.
+ * Parses json and sets oatpp DTO fields directly without building intermediate &id:oatpp::data::mapping::Tree;. <br>
+ * Only `Tree` values and fields with type selectors are parsed to &id:oatpp::data::mapping::Tree; first.
+ */
+class ObjectDeserializer : public base::Countable {
+public:
+  typedef oatpp::data::type::Type Type;
+public:
+
+  struct State {
+
+    const data::mapping::TreeToObjectMapper::Config* mapperConfig;
+    const Deserializer::Config* config;
+    utils::parser::Caret* caret;
+
+    data::mapping::ErrorStack errorStack;
+
+  };
+
+public:
+  typedef oatpp::Void (*DeserializerMethod)(const ObjectDeserializer*, State&, const Type* const);
+public:
+
+  template<class T>
+  static oatpp::Void deserializePrimitive(const ObjectDeserializer* deserializer, State& state, const Type* const type){
+    (void) deserializer;
+    (void) type;
+    data::mapping::Tree node;
+    if(!deserializePrimitiveNode(state, node)) {
+      state.errorStack.push("[oatpp::json::ObjectDeserializer::deserializePrimitive()]: Value is NOT a Primitive type");
+      return nullptr;
+    }
+    if(node.isNull()) {
+      return oatpp::Void(T::Class::getType());
+    }
+    return T(node.operator typename T::UnderlyingType());
+  }
+
+  static oatpp::Void deserializeString(const ObjectDeserializer* deserializer, State& state, const Type* type);
+  static oatpp::Void deserializeTree(const ObjectDeserializer* deserializer, State& state, const Type* type);
+  static oatpp::Void deserializeAny(const ObjectDeserializer* deserializer, State& state, const Type* type);
+  static oatpp::Void deserializeEnum(const ObjectDeserializer* deserializer, State& state, const Type* type);
+
+  static oatpp::Void deserializeCollection(const ObjectDeserializer* deserializer, State& state, const Type* type);
+  static oatpp::Void deserializeMap(const ObjectDeserializer* deserializer, State& state, const Type* type);
+
+  static oatpp::Void deserializeObject(const ObjectDeserializer* deserializer, State& state, const Type* type);
+
+private:
+
+  /*
+   * Parse json null, boolean or number to the primitive node. Primitive nodes are not heap-allocated.
+   * @return - `false` if value at caret is not a primitive.
+   */
+  static bool deserializePrimitiveNode(State& state, data::mapping::Tree& node);
+
+  /*
+   * Parse json value at caret to &id:oatpp::data::mapping::Tree;.
+   */
+  static void deserializeToTree(State& state, data::mapping::Tree& tree);
+
+  static bool isNullAtCaret(State& state);
+
+private:
+  std::vector<DeserializerMethod> m_methods;
+  data::mapping::TreeToObjectMapper m_treeToObjectMapper;
+public:
+
+  ObjectDeserializer();
+
+  void setDeserializerMethod(const data::type::ClassId& classId, DeserializerMethod method);
+
+  oatpp::Void deserialize(State& state, const Type* type) const;
+
+};
+
+}}
+
+#endif // oatpp_json_ObjectDeserializer_hpp
@@ -52,6 +52,17 @@ void ObjectMapper::write(data::stream::ConsistentOutputStream* stream, const oat
     return;
   }
 
+  if(m_serializerConfig.bypassTree) {
+    ObjectSerializer::State state;
+    state.mapperConfig = &m_serializerConfig.mapper;
+    state.config = &m_serializerConfig.json;
+    m_objectSerializer.serializeToStream(stream, state, variant);
+    if(!state.errorStack.empty()) {
+      errorStack = std::move(state.errorStack);
+    }
+    return;
+  }
+
   data::mapping::Tree tree;
   data::mapping::ObjectToTreeMapper::State state;
 
@@ -70,6 +81,19 @@ void ObjectMapper::write(data::stream::ConsistentOutputStream* stream, const oat
 
 oatpp::Void ObjectMapper::read(utils::parser::Caret& caret, const data::type::Type* type, data::mapping::ErrorStack& errorStack) const {
 
+  if(m_deserializerConfig.bypassTree) {
+    ObjectDeserializer::State state;
+    state.caret = &caret;
+    state.mapperConfig = &m_deserializerConfig.mapper;
+    state.config = &m_deserializerConfig.json;
+    const auto& result = m_objectDeserializer.deserialize(state, type);
+    if(!state.errorStack.empty()) {
+      errorStack = std::move(state.errorStack);
+      return nullptr;
+    }
+    return result;
+  }
+
   data::mapping::Tree tree;
 
   {
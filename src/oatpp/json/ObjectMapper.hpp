@@ -27,6 +27,8 @@
 
 #include "./Serializer.hpp"
 #include "./Deserializer.hpp"
+#include "./ObjectSerializer.hpp"
+#include "./ObjectDeserializer.hpp"
 
 #include "oatpp/data/mapping/ObjectToTreeMapper.hpp"
 #include "oatpp/data/mapping/TreeToObjectMapper.hpp"
@@ -50,16 +52,41 @@ public:
 
   class DeserializerConfig {
   public:
+
+    DeserializerConfig()
+      : bypassTree(false)
+    {}
+
     data::mapping::TreeToObjectMapper::Config mapper;
     Deserializer::Config json;
+
+    /**
+     * Deserialize objects directly from the caret with &id:oatpp::json::ObjectDeserializer;
+     * instead of parsing the whole document to intermediate &id:oatpp::data::mapping::Tree; first.
+     */
+    bool bypassTree;
   };
 
 public:
 
   class SerializerConfig {
   public:
+
+    SerializerConfig()
+      : bypassTree(false)
+    {}
+
     data::mapping::ObjectToTreeMapper::Config mapper;
     Serializer::Config json;
+
+    /**
+     * Serialize objects directly to the output stream with &id:oatpp::json::ObjectSerializer;
+     * instead of building intermediate &id:oatpp::data::mapping::Tree;. <br>
+     * *Note: values are validated as they are written. If serialization fails (for example, on a missing required field),
+     * the json written before the failed value stays in the stream. Serialize into a buffer if the output
+     * must not be touched on error - &id:oatpp::data::mapping::ObjectMapper::writeToString; does that.*
+     */
+    bool bypassTree;
   };
 
 private:
@@ -69,7 +96,9 @@ private:
   DeserializerConfig m_deserializerConfig;
 private:
   data::mapping::ObjectToTreeMapper m_objectToTreeMapper;
+  ObjectSerializer m_objectSerializer;
   data::mapping::TreeToObjectMapper m_treeToObjectMapper;
+  ObjectDeserializer m_objectDeserializer;
 public:
 
   ObjectMapper(const SerializerConfig& serializerConfig = {}, const DeserializerConfig& deserializerConfig = {});
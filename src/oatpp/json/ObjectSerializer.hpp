@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_json_ObjectSerializer_hpp
+#define oatpp_json_ObjectSerializer_hpp
+
+#include "./Serializer.hpp"
+
+#include "oatpp/data/mapping/ObjectToTreeMapper.hpp"
+
+namespace oatpp { namespace json {
+
+/**
+ * Streaming Json Serializer.
+ * Walks oatpp DTO objects and writes json directly to the output stream
+ * without building intermediate &id:oatpp::data::mapping::Tree;. <br>
+ * Produces the same output as &id:oatpp::data::mapping::ObjectToTreeMapper; followed by &id:oatpp::json::Serializer;.
+ */
+class ObjectSerializer : public base::Countable {
+public:
+
+  struct State {
+
+    const data::mapping::ObjectToTreeMapper::Config* mapperConfig;
+    const Serializer::Config* config;
+    data::stream::ConsistentOutputStream* stream;
+
+    data::mapping::ErrorStack errorStack;
+
+  };
+
+public:
+  typedef void (*SerializerMethod)(const ObjectSerializer*, State&, const oatpp::Void&);
+public:
+
+  template<class T>
+  static void serializePrimitive(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph){
+    (void) serializer;
+    if(polymorph){
+      state.stream->writeAsString(* static_cast<typename T::ObjectType*>(polymorph.get()));
+    } else {
+      state.stream->writeSimple("null", 4);
+    }
+  }
+
+  static void serializeString(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph);
+  static void serializeTree(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph);
+  static void serializeAny(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph);
+  static void serializeEnum(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph);
+
+  static void serializeCollection(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph);
+  static void serializeMap(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph);
+
+  static void serializeObject(const ObjectSerializer* serializer, State& state, const oatpp::Void& polymorph);
+
+private:
+
+  /*
+   * Check if value will be serialized as json `null`.
+   * Tree path drops such nodes when &id:oatpp::json::Serializer::Config::includeNullElements; is false.
+   */
+  static bool isNullValue(const oatpp::Void& polymorph);
+
+private:
+  std::vector<SerializerMethod> m_methods;
+public:
+
+  ObjectSerializer();
+
+  void setSerializerMethod(const data::type::ClassId& classId, SerializerMethod method);
+
+  void serialize(State& state, const oatpp::Void& polymorph) const;
+
+  /**
+   * Serialize object to stream. Applies &id:oatpp::json::Beautifier; if configured. <br>
+   * *Note: unlike the &id:oatpp::data::mapping::Tree; path, values are validated as they are written.
+   * On error `state.errorStack` is filled, and the stream keeps the partial json written before the failed value.*
+   * @param stream - destination stream.
+   * @param state - serializer state.
+   * @param polymorph - object to serialize.
+   */
+  void serializeToStream(data::stream::ConsistentOutputStream* stream, State& state, const oatpp::Void& polymorph) const;
+
+};
+
+}}
+
+#endif // oatpp_json_ObjectSerializer_hpp
@@ -31,9 +31,12 @@
 namespace oatpp { namespace json {
 
 void Serializer::serializeString(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size, v_uint32 escapeFlags) {
-  auto encodedValue = Utils::escapeString(data, size, escapeFlags);
   stream->writeCharSimple('\"');
-  stream->writeSimple(encodedValue);
+  if(Utils::isEscapingRequired(data, size, escapeFlags)) {
+    stream->writeSimple(Utils::escapeString(data, size, escapeFlags));
+  } else {
+    stream->writeSimple(data, size);
+  }
   stream->writeCharSimple('\"');
 }
 
@@ -89,21 +89,32 @@ public:
 
 private:
 
-  
-  static void serializeString(oatpp::data::stream::ConsistentOutputStream* stream,
-                              const char* data,
-                              v_buff_size size,
-                              v_uint32 escapeFlags);
-
   static void serializeNull(State& state);
   static void serializeString(State& state);
   static void serializeArray(State& state);
   static void serializeMap(State& state);
   static void serializePairs(State& state);
 
+public:
+
+  /**
+   * Write escaped json string (with quotes) to stream.
+   * @param stream - destination stream.
+   * @param data - string data.
+   * @param size - string size.
+   * @param escapeFlags - see &id:oatpp::json::Utils::escapeString;.
+   */
+  static void serializeString(oatpp::data::stream::ConsistentOutputStream* stream,
+                              const char* data,
+                              v_buff_size size,
+                              v_uint32 escapeFlags);
+
+  /**
+   * Serialize `state.tree` to `state.stream` as is. No beautifier applied.
+   * @param state
+   */
   static void serialize(State& state);
 
-public:
 
   static void serializeToStream(data::stream::ConsistentOutputStream* stream, State& state);
 
@@ -219,6 +219,11 @@ v_buff_size Utils::escapeUtf8Char(const char* sequence, p_char8 buffer){
   }
 }
 
+bool Utils::isEscapingRequired(const char* data, v_buff_size size, v_uint32 flags) {
+  v_buff_size safeSize;
+  return calcEscapedStringSize(data, size, safeSize, flags) != size;
+}
+
 oatpp::String Utils::escapeString(const char* data, v_buff_size size, v_uint32 flags) {
   v_buff_size safeSize;
   v_buff_size escapedSize = calcEscapedStringSize(data, size, safeSize, flags);
@@ -88,6 +88,15 @@ public:
    */
   static String escapeString(const char* data, v_buff_size size, v_uint32 flags = FLAG_ESCAPE_ALL);
 
+  /**
+   * Check if string has to be escaped as for json standard.
+   * @param data - pointer to string to check.
+   * @param size - data size.
+   * @param flags - escape flags.
+   * @return - `true` if &l:Utils::escapeString (); would modify the string.
+   */
+  static bool isEscapingRequired(const char* data, v_buff_size size, v_uint32 flags = FLAG_ESCAPE_ALL);
+
   /**
    * Unescape string as for json standard.
    * @param data - pointer to string to unescape.
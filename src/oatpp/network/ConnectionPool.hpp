@@ -42,6 +42,7 @@ struct ConnectionAcquisitionProxy : public provider::AcquisitionProxy<data::stre
   {}
 
   v_io_size write(const void *buff, v_buff_size count, async::Action& action) override;
+  v_io_size writeVector(const data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action) override;
   v_io_size read(void *buff, v_buff_size count, async::Action& action) override;
 
   void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override;
@@ -42,6 +42,65 @@ Server::Server(const std::shared_ptr<ConnectionProvider> &connectionProvider,
     , m_connectionHandler(connectionHandler)
     , m_threaded(false) {}
 
+namespace {
+
+class AcceptLoopCoroutine : public async::Coroutine<AcceptLoopCoroutine> {
+private:
+  std::shared_ptr<ConnectionProvider> m_connectionProvider;
+  std::shared_ptr<ConnectionHandler> m_connectionHandler;
+  std::shared_ptr<std::atomic<bool>> m_active;
+  std::shared_ptr<const std::unordered_map<oatpp::String, oatpp::String>> m_params;
+  bool m_backoff;
+public:
+
+  AcceptLoopCoroutine(const std::shared_ptr<ConnectionProvider>& connectionProvider,
+                      const std::shared_ptr<ConnectionHandler>& connectionHandler,
+                      const std::shared_ptr<std::atomic<bool>>& active)
+    : m_connectionProvider(connectionProvider)
+    , m_connectionHandler(connectionHandler)
+    , m_active(active)
+    , m_backoff(false)
+  {}
+
+  Action act() override {
+    if(!m_active->load()) {
+      return finish();
+    }
+    return m_connectionProvider->getAsync().callbackTo(&AcceptLoopCoroutine::onConnection);
+  }
+
+  Action onConnection(const provider::ResourceHandle<data::stream::IOStream>& connection) {
+    if (!connection) {
+      return yieldTo(&AcceptLoopCoroutine::backoff);
+    }
+    if (m_active->load()) {
+      m_connectionHandler->handleConnection(connection, m_params /* null params */);
+    } else {
+      OATPP_LOGD("[oatpp::network::server::AcceptLoopCoroutine]", "Error. Server already stopped - closing connection...")
+    }
+    return yieldTo(&AcceptLoopCoroutine::act);
+  }
+
+  /* provider is stopped or accept() failed - don't spin on the processor */
+  Action backoff() {
+    if (m_backoff) {
+      m_backoff = false;
+      return yieldTo(&AcceptLoopCoroutine::act);
+    }
+    m_backoff = true;
+    return waitRepeat(std::chrono::milliseconds(100));
+  }
+
+  Action handleError(Error* error) override {
+    OATPP_LOGE("[oatpp::network::server::AcceptLoopCoroutine]", "Error. %s. Accept loop stopped.", error->what())
+    m_active->store(false);
+    return finish();
+  }
+
+};
+
+}
+
 // This isn't implemented as static since threading is dropped and therefore static isn't needed anymore.
 void Server::conditionalMainLoop() {
 
@@ -142,6 +201,26 @@ void Server::run(bool startAsNewThread) {
   }
 }
 
+void Server::runAsync(const std::shared_ptr<async::Executor>& executor) {
+  std::lock_guard<std::mutex> lg(m_mutex);
+  switch (getStatus()) {
+    case STATUS_STARTING:
+      throw std::runtime_error("[oatpp::network::server::runAsync()] Error. Server already starting");
+    case STATUS_RUNNING:
+      throw std::runtime_error("[oatpp::network::server::runAsync()] Error. Server already started");
+    default:
+      break;
+  }
+
+  m_threaded = false;
+  setStatus(STATUS_CREATED, STATUS_STARTING);
+
+  m_asyncLoopActive = std::make_shared<std::atomic<bool>>(true);
+  executor->execute<AcceptLoopCoroutine>(m_connectionProvider, m_connectionHandler, m_asyncLoopActive);
+
+  setStatus(STATUS_STARTING, STATUS_RUNNING);
+}
+
 void Server::stop() {
   std::lock_guard<std::mutex> lg(m_mutex);
   switch (getStatus()) {
@@ -158,6 +237,13 @@ void Server::stop() {
   if (m_threaded && m_thread.joinable()) {
     m_thread.join();
   }
+
+  /* accept loop coroutine doesn't reference the server - it exits on its own */
+  if (m_asyncLoopActive) {
+    m_asyncLoopActive->store(false);
+    m_asyncLoopActive.reset();
+    setStatus(STATUS_DONE);
+  }
 }
 
 bool Server::setStatus(v_int32 expectedStatus, v_int32 newStatus) {
@@ -28,6 +28,8 @@
 #include "oatpp/network/ConnectionHandler.hpp"
 #include "oatpp/network/ConnectionProvider.hpp"
 
+#include "oatpp/async/Executor.hpp"
+
 #include "oatpp/Types.hpp"
 
 #include "oatpp/base/Countable.hpp"
@@ -63,6 +65,7 @@ private:
   std::shared_ptr<ConnectionHandler> m_connectionHandler;
 
   bool m_threaded;
+  std::shared_ptr<std::atomic<bool>> m_asyncLoopActive;
   
 public:
 
@@ -137,6 +140,16 @@ public:
    */
   void run(bool startAsNewThread);
 
+  /**
+   * Run accept loop as a coroutine in the executor - no dedicated thread is blocked on accept. <br>
+   * Calls &id:oatpp::network::ConnectionProvider::getAsync; in the loop and passes obtained Connection
+   * to &id:oatpp::network::ConnectionHandler;. Returns immediately. <br>
+   * *Note: the loop exits once the server is stopped and the connection provider returns -
+   * call &id:oatpp::network::ConnectionProvider::stop; to release it.*
+   * @param executor - &id:oatpp::async::Executor; to run the accept loop in.
+   */
+  void runAsync(const std::shared_ptr<async::Executor>& executor);
+
   /**
    * Break server loop.
    * Note: thread can still be blocked on the &l:Server::run (); call as it may be waiting for ConnectionProvider to provide connection.
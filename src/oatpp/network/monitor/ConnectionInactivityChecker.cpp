@@ -24,6 +24,8 @@
 
 #include "ConnectionInactivityChecker.hpp"
 
+#include <algorithm>
+
 namespace oatpp { namespace network { namespace monitor {
 
 ConnectionInactivityChecker::ConnectionInactivityChecker(const std::chrono::duration<v_int64, std::micro>& lastReadTimeout,
@@ -60,4 +62,11 @@ bool ConnectionInactivityChecker::check(const ConnectionStats& stats, v_int64 cu
   return  goodRead && goodWrite;
 }
 
+v_int64 ConnectionInactivityChecker::getDeadline(const ConnectionStats& stats, v_int64 currMicroTime) {
+  (void) currMicroTime;
+  auto lastRead = stats.timestampLastRead == 0 ? stats.timestampCreated : stats.timestampLastRead;
+  auto lastWrite = stats.timestampLastWrite == 0 ? stats.timestampCreated : stats.timestampLastWrite;
+  return std::min(lastRead + m_lastReadTimeout.count(), lastWrite + m_lastWriteTimeout.count());
+}
+
 }}}
@@ -54,6 +54,8 @@ public:
 
   bool check(const ConnectionStats& stats, v_int64 currMicroTime) override;
 
+  v_int64 getDeadline(const ConnectionStats& stats, v_int64 currMicroTime) override;
+
 };
 
 }}}
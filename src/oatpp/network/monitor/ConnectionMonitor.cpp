@@ -26,9 +26,16 @@
 
 #include <chrono>
 #include <thread>
+#include <algorithm>
+#include <limits>
 
 namespace oatpp { namespace network { namespace monitor {
 
+/* out-of-line definitions of ODR-used constants (C++11) */
+constexpr v_int32 ConnectionMonitor::MAX_STAT_COLLECTORS;
+constexpr v_int64 ConnectionMonitor::TICK_MICROS;
+constexpr v_int64 ConnectionMonitor::WHEEL_SIZE;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConnectionMonitor::ConnectionInvalidator
 
@@ -37,6 +44,15 @@ void ConnectionMonitor::ConnectionInvalidator::invalidate(const std::shared_ptr<
   proxy->invalidate();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ConnectionMonitor::AtomicStats
+
+ConnectionMonitor::AtomicStats::AtomicStats() {
+  for(auto& data : metricsData) {
+    data.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConnectionMonitor::ConnectionProxy
 
@@ -51,32 +67,24 @@ ConnectionMonitor::ConnectionProxy::ConnectionProxy(const std::shared_ptr<Monito
 ConnectionMonitor::ConnectionProxy::~ConnectionProxy() {
 
   m_monitor->removeConnection(reinterpret_cast<v_uint64>(this));
-
-  std::lock_guard<std::mutex> lock(m_statsMutex);
-
   m_monitor->freeConnectionStats(m_stats);
 
-  if(m_stats.metricsData.size() > 0) {
-
-    for(auto& pair : m_stats.metricsData) {
-      OATPP_LOGE("[oatpp::network::ConnectionMonitor::ConnectionProxy::~ConnectionProxy()]",
-                 "Error. Memory leak. Metric data was not deleted: Metric name - '%s'", pair.first->c_str())
-    }
-
-  }
-
 }
 
 v_io_size ConnectionMonitor::ConnectionProxy::read(void *buffer, v_buff_size count, async::Action& action) {
   auto res = m_connectionHandle.object->read(buffer, count, action);
-  std::lock_guard<std::mutex> lock(m_statsMutex);
   m_monitor->onConnectionRead(m_stats, res);
   return res;
 }
 
 v_io_size ConnectionMonitor::ConnectionProxy::write(const void *data, v_buff_size count, async::Action& action) {
   auto res = m_connectionHandle.object->write(data, count, action);
-  std::lock_guard<std::mutex> lock(m_statsMutex);
+  m_monitor->onConnectionWrite(m_stats, res);
+  return res;
+}
+
+v_io_size ConnectionMonitor::ConnectionProxy::writeVector(const data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action) {
+  auto res = m_connectionHandle.object->writeVector(buffers, count, action);
   m_monitor->onConnectionWrite(m_stats, res);
   return res;
 }
@@ -117,28 +125,25 @@ void ConnectionMonitor::Monitor::monitorTask(std::shared_ptr<Monitor> monitor) {
     {
 
       std::lock_guard<std::mutex> lock(monitor->m_connectionsMutex);
+      std::lock_guard<std::mutex> analysersLock(monitor->m_checkMutex);
 
       auto currMicroTime = oatpp::Environment::getMicroTickCount();
+      auto targetTick = currMicroTime / TICK_MICROS;
 
-      for(auto& caddr : monitor->m_connections) {
-
-        auto connection = reinterpret_cast<ConnectionProxy*>(caddr);
-        std::lock_guard<std::mutex> dataLock(connection->m_statsMutex);
-        std::lock_guard<std::mutex> analysersLock(monitor->m_checkMutex);
-
-        for(auto& a : monitor->m_metricsCheckers) {
-          bool res = a->check(connection->m_stats, currMicroTime);
-          if(!res) {
-            connection->invalidate();
-            break;
-          }
+      if(monitor->m_rescheduleAll.exchange(false)) {
+        for(auto& pair : monitor->m_connections) {
+          monitor->schedule(pair.first, monitor->m_currentTick);
         }
+      }
 
+      while(monitor->m_currentTick <= targetTick) {
+        monitor->processTick(monitor->m_currentTick, currMicroTime);
+        monitor->m_currentTick ++;
       }
 
     }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    std::this_thread::sleep_for(std::chrono::microseconds(TICK_MICROS));
 
   }
 
@@ -151,18 +156,105 @@ void ConnectionMonitor::Monitor::monitorTask(std::shared_ptr<Monitor> monitor) {
 
 }
 
-void* ConnectionMonitor::Monitor::createOrGetMetricData(ConnectionStats& stats, const std::shared_ptr<StatCollector>& collector) {
-  void* data;
-  auto it = stats.metricsData.find(collector->metricName());
-  if(it == stats.metricsData.end()) {
+void ConnectionMonitor::Monitor::schedule(v_uint64 connection, v_int64 tick) {
+  m_connections[connection] = tick;
+  m_wheel[static_cast<size_t>(tick % WHEEL_SIZE)].push_back({connection, tick});
+}
+
+void ConnectionMonitor::Monitor::processTick(v_int64 tick, v_int64 currMicroTime) {
+
+  std::vector<WheelEntry> entries;
+  std::swap(entries, m_wheel[static_cast<size_t>(tick % WHEEL_SIZE)]);
+
+  for(auto& entry : entries) {
+
+    auto it = m_connections.find(entry.connection);
+    if(it == m_connections.end() || it->second != entry.tick) {
+      continue; // stale entry
+    }
+
+    if(entry.tick > tick) {
+      m_wheel[static_cast<size_t>(tick % WHEEL_SIZE)].push_back(entry); // deadline is one or more wheel rounds away
+      continue;
+    }
+
+    auto connection = reinterpret_cast<ConnectionProxy*>(entry.connection);
+    auto stats = makeSnapshot(connection->m_stats);
+
+    bool good = true;
+    v_int64 deadline = std::numeric_limits<v_int64>::max();
+
+    for(auto& a : m_metricsCheckers) {
+      if(!a->check(stats, currMicroTime)) {
+        good = false;
+        break;
+      }
+      deadline = std::min(deadline, a->getDeadline(stats, currMicroTime));
+    }
+
+    if(!good) {
+      it->second = -1; // not scheduled anymore
+      connection->invalidate();
+      continue;
+    }
+
+    if(m_metricsCheckers.empty()) {
+      it->second = -1; // will be rescheduled when a checker is added
+      continue;
+    }
+
+    schedule(entry.connection, std::max(deadline / TICK_MICROS, tick + 1));
+
+  }
+
+}
+
+void* ConnectionMonitor::Monitor::createOrGetMetricData(AtomicStats& stats, v_int32 slot, StatCollector* collector) {
+  auto& slotData = stats.metricsData[slot];
+  void* data = slotData.load(std::memory_order_acquire);
+  if(data == nullptr) {
     data = collector->createMetricData();
-    stats.metricsData.insert({collector->metricName(), data});
-  } else {
-    data = it->second;
+    void* expected = nullptr;
+    if(!slotData.compare_exchange_strong(expected, data, std::memory_order_acq_rel)) {
+      collector->deleteMetricData(data);
+      data = expected;
+    }
   }
   return data;
 }
 
+ConnectionStats ConnectionMonitor::Monitor::makeSnapshot(const AtomicStats& stats) {
+
+  ConnectionStats result;
+  result.timestampCreated = stats.timestampCreated;
+  result.totalRead = stats.totalRead.load(std::memory_order_relaxed);
+  result.totalWrite = stats.totalWrite.load(std::memory_order_relaxed);
+  result.timestampLastRead = stats.timestampLastRead.load(std::memory_order_relaxed);
+  result.timestampLastWrite = stats.timestampLastWrite.load(std::memory_order_relaxed);
+  result.lastReadSize = stats.lastReadSize.load(std::memory_order_relaxed);
+  result.lastWriteSize = stats.lastWriteSize.load(std::memory_order_relaxed);
+
+  auto count = m_statCollectorsCount.load(std::memory_order_acquire);
+  for(v_int32 i = 0; i < count; i ++) {
+    auto data = stats.metricsData[i].load(std::memory_order_acquire);
+    if(data != nullptr && m_activeCollectors[i].load(std::memory_order_relaxed) != nullptr) {
+      result.metricsData.insert({m_statCollectors[static_cast<size_t>(i)]->metricName(), data});
+    }
+  }
+
+  return result;
+
+}
+
+ConnectionMonitor::Monitor::Monitor()
+  : m_wheel(static_cast<size_t>(WHEEL_SIZE))
+  , m_currentTick(oatpp::Environment::getMicroTickCount() / TICK_MICROS)
+{
+  for(auto& collector : m_activeCollectors) {
+    collector.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
 std::shared_ptr<ConnectionMonitor::Monitor> ConnectionMonitor::Monitor::createShared() {
   auto monitor = std::make_shared<Monitor>();
   std::thread t([monitor](){
@@ -174,20 +266,18 @@ std::shared_ptr<ConnectionMonitor::Monitor> ConnectionMonitor::Monitor::createSh
 
 void ConnectionMonitor::Monitor::addConnection(ConnectionProxy* connection) {
   std::lock_guard<std::mutex> lock(m_connectionsMutex);
-  m_connections.insert(reinterpret_cast<v_uint64>(connection));
+  /* examine the new connection on the next tick to get its deadline */
+  schedule(reinterpret_cast<v_uint64>(connection), m_currentTick + 1);
 }
 
-void ConnectionMonitor::Monitor::freeConnectionStats(ConnectionStats& stats) {
+void ConnectionMonitor::Monitor::freeConnectionStats(AtomicStats& stats) {
 
   std::lock_guard<std::mutex> lock(m_checkMutex);
 
-  for(auto& metric : stats.metricsData) {
-    auto it = m_statCollectors.find(metric.first);
-    if(it != m_statCollectors.end()) {
-      it->second->deleteMetricData(metric.second);
-    } else {
-      OATPP_LOGE("[oatpp::network::ConnectionMonitor::Monitor::freeConnectionStats]",
-                 "Error. Can't free Metric data. Unknown Metric: name - '%s'", metric.first->c_str())
+  for(size_t i = 0; i < m_statCollectors.size(); i ++) {
+    auto data = stats.metricsData[i].exchange(nullptr, std::memory_order_acquire);
+    if(data != nullptr) {
+      m_statCollectors[i]->deleteMetricData(data);
     }
   }
 
@@ -200,67 +290,103 @@ void ConnectionMonitor::Monitor::removeConnection(v_uint64 id) {
 
 void ConnectionMonitor::Monitor::invalidateAll() {
   std::lock_guard<std::mutex> lock(m_connectionsMutex);
-  for(v_uint64 caddr : m_connections) {
-    auto connection = reinterpret_cast<ConnectionProxy*>(caddr);
+  for(auto& pair : m_connections) {
+    auto connection = reinterpret_cast<ConnectionProxy*>(pair.first);
     connection->invalidate();
   }
 }
 
+void ConnectionMonitor::Monitor::addStatCollector_Unsafe(const std::shared_ptr<StatCollector>& collector) {
+
+  auto name = collector->metricName();
+  for(size_t i = 0; i < m_statCollectors.size(); i ++) {
+    if(m_activeCollectors[i].load(std::memory_order_relaxed) != nullptr && m_statCollectors[i]->metricName() == name) {
+      return;
+    }
+  }
+
+  if(m_statCollectors.size() >= static_cast<size_t>(MAX_STAT_COLLECTORS)) {
+    OATPP_LOGE("[oatpp::network::ConnectionMonitor::Monitor::addStatCollector()]",
+               "Error. Too many stat collectors. Max - %d.", MAX_STAT_COLLECTORS)
+    throw std::runtime_error("[oatpp::network::ConnectionMonitor::Monitor::addStatCollector()]: Error. Too many stat collectors.");
+  }
+
+  auto slot = m_statCollectors.size();
+  m_statCollectors.push_back(collector);
+  m_activeCollectors[slot].store(collector.get(), std::memory_order_release);
+  m_statCollectorsCount.store(static_cast<v_int32>(m_statCollectors.size()), std::memory_order_release);
+
+}
+
 void ConnectionMonitor::Monitor::addStatCollector(const std::shared_ptr<StatCollector>& collector) {
   std::lock_guard<std::mutex> lock(m_checkMutex);
-  m_statCollectors.insert({collector->metricName(), collector});
+  addStatCollector_Unsafe(collector);
 }
 
 void ConnectionMonitor::Monitor::removeStatCollector(const oatpp::String& metricName) {
   std::lock_guard<std::mutex> lock(m_checkMutex);
-  m_statCollectors.erase(metricName);
+  for(size_t i = 0; i < m_statCollectors.size(); i ++) {
+    if(m_statCollectors[i]->metricName() == metricName) {
+      /* keep the collector itself - it is still needed to free the metric data of live connections */
+      m_activeCollectors[i].store(nullptr, std::memory_order_release);
+    }
+  }
 }
 
 void ConnectionMonitor::Monitor::addMetricsChecker(const std::shared_ptr<MetricsChecker>& checker) {
   std::lock_guard<std::mutex> lock(m_checkMutex);
   m_metricsCheckers.push_back(checker);
+  m_rescheduleAll = true;
   auto metrics = checker->getMetricsList();
   for(auto& m : metrics) {
-    auto it = m_statCollectors.find(m);
-    if(it == m_statCollectors.end()) {
-      m_statCollectors.insert({m, checker->createStatCollector(m)});
+    bool exists = false;
+    for(size_t i = 0; i < m_statCollectors.size(); i ++) {
+      if(m_activeCollectors[i].load(std::memory_order_relaxed) != nullptr && m_statCollectors[i]->metricName() == m) {
+        exists = true;
+        break;
+      }
+    }
+    if(!exists) {
+      addStatCollector_Unsafe(checker->createStatCollector(m));
     }
   }
 }
 
-void ConnectionMonitor::Monitor::onConnectionRead(ConnectionStats& stats, v_io_size readResult) {
+void ConnectionMonitor::Monitor::onConnectionRead(AtomicStats& stats, v_io_size readResult) {
 
   v_int64 currTimestamp = oatpp::Environment::getMicroTickCount();
 
   if(readResult > 0) {
-    stats.totalRead += readResult;
-    stats.lastReadSize = readResult;
-    stats.timestampLastRead = currTimestamp;
+    stats.totalRead.fetch_add(readResult, std::memory_order_relaxed);
+    stats.lastReadSize.store(readResult, std::memory_order_relaxed);
+    stats.timestampLastRead.store(currTimestamp, std::memory_order_relaxed);
   }
 
-  {
-    std::lock_guard<std::mutex> lock(m_checkMutex);
-    for(auto& pair : m_statCollectors) {
-      pair.second->onRead(createOrGetMetricData(stats, pair.second), readResult, currTimestamp);
+  auto count = m_statCollectorsCount.load(std::memory_order_acquire);
+  for(v_int32 i = 0; i < count; i ++) {
+    auto collector = m_activeCollectors[i].load(std::memory_order_acquire);
+    if(collector != nullptr) {
+      collector->onRead(createOrGetMetricData(stats, i, collector), readResult, currTimestamp);
     }
   }
 
 }
 
-void ConnectionMonitor::Monitor::onConnectionWrite(ConnectionStats& stats, v_io_size writeResult) {
+void ConnectionMonitor::Monitor::onConnectionWrite(AtomicStats& stats, v_io_size writeResult) {
 
   v_int64 currTimestamp = oatpp::Environment::getMicroTickCount();
 
   if(writeResult > 0) {
-    stats.totalWrite += writeResult;
-    stats.lastWriteSize = writeResult;
-    stats.timestampLastWrite = currTimestamp;
+    stats.totalWrite.fetch_add(writeResult, std::memory_order_relaxed);
+    stats.lastWriteSize.store(writeResult, std::memory_order_relaxed);
+    stats.timestampLastWrite.store(currTimestamp, std::memory_order_relaxed);
   }
 
-  {
-    std::lock_guard<std::mutex> lock(m_checkMutex);
-    for(auto& pair : m_statCollectors) {
-      pair.second->onWrite(createOrGetMetricData(stats, pair.second), writeResult, currTimestamp);
+  auto count = m_statCollectorsCount.load(std::memory_order_acquire);
+  for(v_int32 i = 0; i < count; i ++) {
+    auto collector = m_activeCollectors[i].load(std::memory_order_acquire);
+    if(collector != nullptr) {
+      collector->onWrite(createOrGetMetricData(stats, i, collector), writeResult, currTimestamp);
     }
   }
 
@@ -30,8 +30,9 @@
 #include "oatpp/network/ConnectionProvider.hpp"
 #include "oatpp/data/stream/Stream.hpp"
 
-#include <unordered_set>
+#include <unordered_map>
 #include <condition_variable>
+#include <atomic>
 
 namespace oatpp { namespace network { namespace monitor {
 
@@ -40,6 +41,23 @@ namespace oatpp { namespace network { namespace monitor {
  * and close those ones that are not satisfy selected rules.
  */
 class ConnectionMonitor : public ClientConnectionProvider, public ServerConnectionProvider {
+public:
+
+  /**
+   * Max number of &id:oatpp::network::monitor::StatCollector; registered in one monitor.
+   */
+  static constexpr v_int32 MAX_STAT_COLLECTORS = 16;
+
+  /**
+   * Resolution of the connection deadlines in microseconds.
+   */
+  static constexpr v_int64 TICK_MICROS = 100 * 1000;
+
+  /**
+   * Number of slots in the deadline wheel. Deadlines further than `WHEEL_SIZE` ticks wrap around.
+   */
+  static constexpr v_int64 WHEEL_SIZE = 1024;
+
 private:
 
   class ConnectionInvalidator : public provider::Invalidator<data::stream::IOStream> {
@@ -53,13 +71,28 @@ private:
 
   class Monitor; // FWD
 
+  /**
+   * Connection stats updated by the IO path with relaxed atomics. <br>
+   * Monitor thread reads them as a &id:oatpp::network::monitor::ConnectionStats; snapshot.
+   */
+  struct AtomicStats {
+    v_int64 timestampCreated = 0;
+    std::atomic<v_io_size> totalRead {0};
+    std::atomic<v_io_size> totalWrite {0};
+    std::atomic<v_int64> timestampLastRead {0};
+    std::atomic<v_int64> timestampLastWrite {0};
+    std::atomic<v_io_size> lastReadSize {0};
+    std::atomic<v_io_size> lastWriteSize {0};
+    std::atomic<void*> metricsData[MAX_STAT_COLLECTORS];
+    AtomicStats();
+  };
+
   class ConnectionProxy : public data::stream::IOStream {
     friend Monitor;
   private:
     std::shared_ptr<Monitor> m_monitor;
     provider::ResourceHandle<data::stream::IOStream> m_connectionHandle;
-    std::mutex m_statsMutex;
-    ConnectionStats m_stats;
+    AtomicStats m_stats;
   public:
 
     ConnectionProxy(const std::shared_ptr<Monitor>& monitor,
@@ -69,6 +102,7 @@ private:
 
     v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
     v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
+    v_io_size writeVector(const data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action) override;
 
     void setInputStreamIOMode(data::stream::IOMode ioMode) override;
     data::stream::IOMode getInputStreamIOMode() override;
@@ -92,23 +126,51 @@ private:
     std::atomic<bool> m_running {true};
     bool m_stopped {false};
 
+    /*
+     * Connections are indexed by deadline in a hashed timer wheel - only the connections which are due
+     * are examined on each tick. Each connection maps to the tick it is currently scheduled for,
+     * wheel entries with a different tick are stale and are dropped when met.
+     */
+    struct WheelEntry {
+      v_uint64 connection;
+      v_int64 tick;
+    };
+
     std::mutex m_connectionsMutex;
-    std::unordered_set<v_uint64> m_connections;
+    std::unordered_map<v_uint64, v_int64> m_connections;
+    std::vector<std::vector<WheelEntry>> m_wheel;
+    v_int64 m_currentTick;
+    std::atomic<bool> m_rescheduleAll {false};
 
     std::mutex m_checkMutex;
     std::vector<std::shared_ptr<MetricsChecker>> m_metricsCheckers;
-    std::unordered_map<oatpp::String, std::shared_ptr<StatCollector>> m_statCollectors;
+
+    /*
+     * Stat collector slots. Slot index is assigned once at registration and never reused,
+     * so the IO path resolves collectors and their per-connection data by index without locking.
+     * Removed collectors stay in m_statCollectors (to free their data) but are cleared in m_activeCollectors.
+     */
+    std::vector<std::shared_ptr<StatCollector>> m_statCollectors;
+    std::atomic<StatCollector*> m_activeCollectors[MAX_STAT_COLLECTORS];
+    std::atomic<v_int32> m_statCollectorsCount {0};
 
   private:
     static void monitorTask(std::shared_ptr<Monitor> monitor);
   private:
-    static void* createOrGetMetricData(ConnectionStats& stats, const std::shared_ptr<StatCollector>& collector);
+    void schedule(v_uint64 connection, v_int64 tick);
+    void processTick(v_int64 tick, v_int64 currMicroTime);
+  private:
+    static void* createOrGetMetricData(AtomicStats& stats, v_int32 slot, StatCollector* collector);
+    void addStatCollector_Unsafe(const std::shared_ptr<StatCollector>& collector);
+    ConnectionStats makeSnapshot(const AtomicStats& stats);
   public:
 
+    Monitor();
+
     static std::shared_ptr<Monitor> createShared();
 
     void addConnection(ConnectionProxy* connection);
-    void freeConnectionStats(ConnectionStats& stats);
+    void freeConnectionStats(AtomicStats& stats);
     void removeConnection(v_uint64 id);
 
     void invalidateAll();
@@ -118,8 +180,8 @@ private:
 
     void addMetricsChecker(const std::shared_ptr<MetricsChecker>& checker);
 
-    void onConnectionRead(ConnectionStats& stats, v_io_size readResult);
-    void onConnectionWrite(ConnectionStats& stats, v_io_size writeResult);
+    void onConnectionRead(AtomicStats& stats, v_io_size readResult);
+    void onConnectionWrite(AtomicStats& stats, v_io_size writeResult);
 
     void stop();
 
@@ -141,6 +203,13 @@ public:
 
   async::CoroutineStarterForResult<const provider::ResourceHandle<data::stream::IOStream>&> getAsync() override;
 
+  /**
+   * Add stat collector. <br>
+   * Collector's `onRead`/`onWrite` are called from the IO path without any locks,
+   * while the monitor thread may read the same metric data in &id:oatpp::network::monitor::MetricsChecker::check;.
+   * Metric data should be safe for such concurrent access (ex.: use atomics).
+   * @param collector - &id:oatpp::network::monitor::StatCollector;.
+   */
   void addStatCollector(const std::shared_ptr<StatCollector>& collector);
 
   /**
@@ -64,6 +64,19 @@ public:
    */
   virtual bool check(const ConnectionStats& stats, v_int64 currMicroTime) = 0;
 
+  /**
+   * Get the earliest time when &l:MetricsChecker::check (); may fail for the connection. <br>
+   * &id:oatpp::network::monitor::ConnectionMonitor; doesn't examine the connection before that time.
+   * Default implementation asks to examine the connection once a second.
+   * @param stats - &id:oatpp::network::monitor::ConnectionStats;.
+   * @param currMicroTime - current time microseconds.
+   * @return - deadline microseconds.
+   */
+  virtual v_int64 getDeadline(const ConnectionStats& stats, v_int64 currMicroTime) {
+    (void) stats;
+    return currMicroTime + 1000 * 1000;
+  }
+
 };
 
 }}}
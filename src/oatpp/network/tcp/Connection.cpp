@@ -30,6 +30,11 @@
 #else
   #include <unistd.h>
   #include <sys/socket.h>
+  #include <sys/uio.h>
+#endif
+
+#ifdef OATPP_NETWORK_TCP_SENDFILE
+  #include <sys/sendfile.h>
 #endif
 
 #include <thread>
@@ -119,34 +124,109 @@ v_io_size Connection::write(const void *buff, v_buff_size count, async::Action&
   auto result = ::send(m_handle, buff, static_cast<size_t>(count), flags);
 
   if(result < 0) {
-    auto e = errno;
+    return handleWriteError(action);
+  }
+  return result;
 
-    bool retry = ((e == EAGAIN) || (e == EWOULDBLOCK));
+#endif
 
-    if(retry){
-      if(m_mode == data::stream::ASYNCHRONOUS) {
-        action = oatpp::async::Action::createIOWaitAction(m_handle, oatpp::async::Action::IOEventType::IO_EVENT_WRITE);
-      }
-      return IOError::RETRY_WRITE; // For async io. In case socket is non-blocking
-    }
+}
 
-    if(e == EINTR) {
-      return IOError::RETRY_WRITE;
-    }
+v_io_size Connection::writeVector(const data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action) {
 
-    if(e == EPIPE) {
-      return IOError::BROKEN_PIPE;
+#if defined(WIN32) || defined(_WIN32)
+
+  return IOStream::writeVector(buffers, count, action);
+
+#else
+
+  static constexpr v_int32 MAX_BUFFERS = 16;
+
+  iovec iov[MAX_BUFFERS];
+  v_int32 iovCount = 0;
+
+  for(v_int32 i = 0; i < count && iovCount < MAX_BUFFERS; i ++) {
+    if(buffers[i].bytesLeft > 0) {
+      iov[iovCount].iov_base = const_cast<void*>(buffers[i].currBufferPtr);
+      iov[iovCount].iov_len = static_cast<size_t>(buffers[i].bytesLeft);
+      iovCount ++;
     }
+  }
 
-    //OATPP_LOGD("Connection", "write errno=%d", e)
-    return IOError::BROKEN_PIPE; // Consider all other errors as a broken pipe.
+  if(iovCount == 0) {
+    return 0;
+  }
+
+  errno = 0;
+  v_int32 flags = 0;
+
+#ifdef MSG_NOSIGNAL
+  flags |= MSG_NOSIGNAL;
+#endif
+
+  msghdr message {};
+  message.msg_iov = iov;
+  message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(iovCount);
+
+  auto result = ::sendmsg(m_handle, &message, flags);
+
+  if(result < 0) {
+    return handleWriteError(action);
+  }
+  return result;
+
+#endif
+
+}
+
+#ifdef OATPP_NETWORK_TCP_SENDFILE
+
+v_io_size Connection::sendFile(v_io_handle fileHandle, v_int64 offset, v_buff_size count, async::Action& action) {
+
+  errno = 0;
+
+  off_t fileOffset = toFileOffset<off_t>(offset);
+  auto result = ::sendfile(m_handle, fileHandle, &fileOffset, static_cast<size_t>(count));
+
+  if(result < 0) {
+    return handleWriteError(action);
   }
   return result;
 
+}
+
 #endif
 
+#if !defined(WIN32) && !defined(_WIN32)
+
+v_io_size Connection::handleWriteError(async::Action& action) {
+
+  auto e = errno;
+
+  bool retry = ((e == EAGAIN) || (e == EWOULDBLOCK));
+
+  if(retry){
+    if(m_mode == data::stream::ASYNCHRONOUS) {
+      action = oatpp::async::Action::createIOWaitAction(m_handle, oatpp::async::Action::IOEventType::IO_EVENT_WRITE);
+    }
+    return IOError::RETRY_WRITE; // For async io. In case socket is non-blocking
+  }
+
+  if(e == EINTR) {
+    return IOError::RETRY_WRITE;
+  }
+
+  if(e == EPIPE) {
+    return IOError::BROKEN_PIPE;
+  }
+
+  //OATPP_LOGD("Connection", "write errno=%d", e)
+  return IOError::BROKEN_PIPE; // Consider all other errors as a broken pipe.
+
 }
 
+#endif
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
@@ -27,6 +27,14 @@
 
 #include "oatpp/data/stream/Stream.hpp"
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+  #define OATPP_NETWORK_TCP_SENDFILE
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace oatpp { namespace network { namespace tcp {
 
 /**
@@ -40,6 +48,7 @@ private:
   data::stream::IOMode m_mode;
 private:
   void setStreamIOMode(oatpp::data::stream::IOMode ioMode);
+  v_io_size handleWriteError(async::Action& action);
 public:
   /**
    * Constructor.
@@ -64,6 +73,33 @@ public:
    */
   v_io_size write(const void *buff, v_buff_size count, async::Action& action) override;
 
+  /**
+   * Implementation of &id:oatpp::data::stream::WriteCallback::writeVector; - `sendmsg` with all buffers in one call. <br>
+   * *Note: on Windows falls back to default (one buffer per call) implementation.*
+   * @param buffers - array of &id:oatpp::data::buffer::InlineWriteData;.
+   * @param count - number of buffers in the array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual amount of bytes written in total. See &id:oatpp::v_io_size;.
+   */
+  v_io_size writeVector(const data::buffer::InlineWriteData* buffers, v_int32 count, async::Action& action) override;
+
+#ifdef OATPP_NETWORK_TCP_SENDFILE
+
+  /**
+   * Send file data to the socket with `sendfile` - data is copied by the kernel, it doesn't go through user space. <br>
+   * *Note: available only if `OATPP_NETWORK_TCP_SENDFILE` is defined (Linux).*
+   * @param fileHandle - file descriptor of the file opened for reading.
+   * @param offset - offset in the file to send data from. Position of the file descriptor is not changed.
+   * @param count - max bytes count to send.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual amount of bytes sent. See &id:oatpp::v_io_size;.
+   */
+  v_io_size sendFile(v_io_handle fileHandle, v_int64 offset, v_buff_size count, async::Action& action);
+
+#endif
+
   /**
    * Implementation of &id:oatpp::data::stream::IOStream::read;.
    * @param buff - buffer to read data to.
@@ -27,6 +27,7 @@
 #include "oatpp/utils/Conversion.hpp"
 
 #include <fcntl.h>
+#include <cstring>
 
 #if defined(WIN32) || defined(_WIN32)
   #include <io.h>
@@ -122,34 +123,170 @@ void ConnectionProvider::ConnectionInvalidator::invalidate(const std::shared_ptr
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConnectionProvider
 
-ConnectionProvider::ConnectionProvider(const network::Address& address, bool useExtendedConnections)
+ConnectionProvider::ConnectionProvider(const network::Address& address, bool useExtendedConnections, bool reusePort)
         : m_invalidator(std::make_shared<ConnectionInvalidator>())
         , m_address(address)
         , m_closed(false)
         , m_useExtendedConnections(useExtendedConnections)
+        , m_reusePort(reusePort)
+        , m_asyncAccept(false)
+        , m_wakeHandle(INVALID_IO_HANDLE)
 {
   setProperty(PROPERTY_HOST, m_address.host);
   setProperty(PROPERTY_PORT, oatpp::utils::Conversion::int32ToStr(m_address.port));
   m_serverHandle = instantiateServer();
 }
 
+std::vector<std::shared_ptr<ConnectionProvider>> ConnectionProvider::createListeners(const network::Address& address,
+                                                                                     v_int32 listenersCount,
+                                                                                     bool useExtendedConnections)
+{
+
+  std::vector<std::shared_ptr<ConnectionProvider>> result;
+  result.reserve(static_cast<size_t>(listenersCount > 1 ? listenersCount : 1));
+
+  auto first = createShared(address, useExtendedConnections, true);
+  result.push_back(first);
+
+  /* port might have been picked by the system - bind the rest to the same port */
+  auto port = oatpp::utils::Conversion::strToInt32(first->getProperty(PROPERTY_PORT).toString()->c_str());
+  network::Address boundAddress(address.host, static_cast<v_uint16>(port), address.family);
+
+  for(v_int32 i = 1; i < listenersCount; i ++) {
+    result.push_back(createShared(boundAddress, useExtendedConnections, true));
+  }
+
+  return result;
+
+}
+
 void ConnectionProvider::setConnectionConfigurer(const std::shared_ptr<ConnectionConfigurer> &connectionConfigurer) {
   m_connectionConfigurer = connectionConfigurer;
 }
 
 ConnectionProvider::~ConnectionProvider() {
   stop();
+  if(m_asyncAccept) {
+    closeServerHandle();
+  }
+  closeWakeHandle();
+}
+
+void ConnectionProvider::closeWakeHandle() {
+  std::lock_guard<std::mutex> lock(m_backlogMutex);
+  if(m_wakeHandle != INVALID_IO_HANDLE) {
+#if defined(WIN32) || defined(_WIN32)
+    ::closesocket(m_wakeHandle);
+#else
+    ::close(m_wakeHandle);
+#endif
+    m_wakeHandle = INVALID_IO_HANDLE;
+  }
+}
+
+void ConnectionProvider::closeServerHandle() {
+#if defined(WIN32) || defined(_WIN32)
+  ::closesocket(m_serverHandle);
+#else
+  ::close(m_serverHandle);
+#endif
+}
+
+#if !defined(__linux__)
+
+void ConnectionProvider::wakeAcceptor() {
+
+  sockaddr_storage address;
+  v_sock_size addressSize = sizeof(address);
+  if(getsockname(m_serverHandle, reinterpret_cast<sockaddr*>(&address), &addressSize) != 0) {
+    OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::wakeAcceptor()]", "Warning. Call to getsockname() failed.")
+    return;
+  }
+
+  /* listening on a wildcard address - connect via loopback */
+  if(address.ss_family == AF_INET) {
+    auto address4 = reinterpret_cast<sockaddr_in*>(&address);
+    if(address4->sin_addr.s_addr == htonl(INADDR_ANY)) {
+      address4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    }
+  } else if(address.ss_family == AF_INET6) {
+    auto address6 = reinterpret_cast<sockaddr_in6*>(&address);
+    if(std::memcmp(&address6->sin6_addr, &in6addr_any, sizeof(in6_addr)) == 0) {
+      address6->sin6_addr = in6addr_loopback;
+    }
+  } else {
+    return;
+  }
+
+  auto handle = socket(address.ss_family, SOCK_STREAM, 0);
+  if(!oatpp::isValidIOHandle(handle)) {
+    OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::wakeAcceptor()]", "Warning. Can't create socket.")
+    return;
+  }
+
+  /*
+   * Non-blocking connect - the connection gets queued by the kernel without being accepted.
+   * The socket is kept open until the coroutine wakes, so the queued connection is not torn down before.
+   */
+#if defined(WIN32) || defined(_WIN32)
+  u_long flags = 1;
+  ioctlsocket(handle, FIONBIO, &flags);
+#else
+  fcntl(handle, F_SETFL, O_NONBLOCK);
+#endif
+
+  connect(handle, reinterpret_cast<sockaddr*>(&address), addressSize);
+
+  std::lock_guard<std::mutex> lock(m_backlogMutex);
+  m_wakeHandle = handle;
+
 }
 
+#endif
+
 void ConnectionProvider::stop() {
-  if(!m_closed) {
+
+  std::list<provider::ResourceHandle<data::stream::IOStream>> backlog;
+
+  {
+    std::lock_guard<std::mutex> lock(m_backlogMutex);
+    if(m_closed) {
+      return;
+    }
     m_closed = true;
+    backlog = std::move(m_backlog);
+  }
+
+  if(m_asyncAccept) {
+
+    /*
+     * Coroutine may be waiting for the accept-socket in the IOEventWorker.
+     * Closing the socket here would remove it from the event queue and the coroutine would be stuck forever.
+     * On Linux shutdown makes the listening socket readable (hang-up) and wakes the coroutine - it then sees m_closed and returns.
+     * Other platforms don't report shutdown of a listening socket - there the socket is made readable by connecting to it.
+     * That's not done with SO_REUSEPORT - another listener on the same port may accept the connection instead.
+     * The socket itself is closed in destructor.
+     */
+
+#if !defined(__linux__)
+    if(m_reusePort) {
+      OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::stop()]",
+                 "Warning. Async accept with SO_REUSEPORT is woken by the next incoming connection only.")
+    } else {
+      wakeAcceptor();
+    }
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
-	  ::closesocket(m_serverHandle);
+    shutdown(m_serverHandle, SD_BOTH);
 #else
-	  ::close(m_serverHandle);
+    shutdown(m_serverHandle, SHUT_RDWR);
 #endif
+
+  } else {
+    closeServerHandle();
   }
+
 }
 
 #if defined(WIN32) || defined(_WIN32)
@@ -182,6 +319,11 @@ oatpp::v_io_handle ConnectionProvider::instantiateServer(){
     throw std::runtime_error("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]: Error. Call to getaddrinfo() failed.");
   }
 
+  if (m_reusePort) {
+    OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+               "Warning. %s is not supported on this platform - ignored", "SO_REUSEPORT")
+  }
+
   struct addrinfo* currResult = result;
   while(currResult != nullptr) {
 
@@ -272,6 +414,13 @@ oatpp::v_io_handle ConnectionProvider::instantiateServer(){
     throw std::runtime_error("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]: Error. Call to getaddrinfo() failed.");
   }
 
+#ifndef SO_REUSEPORT
+  if (m_reusePort) {
+    OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+               "Warning. %s is not supported on this platform - ignored", "SO_REUSEPORT")
+  }
+#endif
+
   addrinfo* currResult = result;
   while(currResult != nullptr) {
 
@@ -284,6 +433,15 @@ oatpp::v_io_handle ConnectionProvider::instantiateServer(){
                    "Warning. Failed to set %s for accepting socket: %s", "SO_REUSEADDR", strerror(errno))
       }
 
+#ifdef SO_REUSEPORT
+      if (m_reusePort) {
+        if (setsockopt(serverHandle, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(int)) != 0) {
+          OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+                     "Warning. Failed to set %s for accepting socket: %s", "SO_REUSEPORT", strerror(errno))
+        }
+      }
+#endif
+
       if (bind(serverHandle, currResult->ai_addr, static_cast<v_sock_size>(currResult->ai_addrlen)) == 0 &&
           listen(serverHandle, 10000) == 0)
       {
@@ -411,8 +569,30 @@ provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getExtended
 
 }
 
+provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::acceptConnection() {
+  if(m_useExtendedConnections) {
+    return getExtendedConnection();
+  }
+  return getDefaultConnection();
+}
+
+provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::popBacklog() {
+  std::lock_guard<std::mutex> lock(m_backlogMutex);
+  if(m_backlog.empty()) {
+    return nullptr;
+  }
+  auto connection = std::move(m_backlog.front());
+  m_backlog.pop_front();
+  return connection;
+}
+
 provider::ResourceHandle<oatpp::data::stream::IOStream> ConnectionProvider::get() {
 
+  auto connection = popBacklog();
+  if(connection) {
+    return connection;
+  }
+
   while(!m_closed) {
 
     fd_set set;
@@ -440,11 +620,109 @@ provider::ResourceHandle<oatpp::data::stream::IOStream> ConnectionProvider::get(
 
   }
 
-  if(m_useExtendedConnections) {
-    return getExtendedConnection();
+  return acceptConnection();
+
+}
+
+oatpp::async::CoroutineStarterForResult<const provider::ResourceHandle<data::stream::IOStream>&> ConnectionProvider::getAsync() {
+
+  class AcceptCoroutine : public oatpp::async::CoroutineWithResult<AcceptCoroutine, const provider::ResourceHandle<oatpp::data::stream::IOStream>&> {
+  private:
+    ConnectionProvider* m_provider;
+  public:
+
+    AcceptCoroutine(ConnectionProvider* provider)
+      : m_provider(provider)
+    {}
+
+    Action act() override {
+
+      if(m_provider->m_closed) {
+        m_provider->closeWakeHandle();
+        return _return(nullptr);
+      }
+
+      auto connection = m_provider->popBacklog();
+      if(connection) {
+        return _return(connection);
+      }
+
+      return yieldTo(&AcceptCoroutine::doAccept);
+
+    }
+
+    Action doAccept() {
+
+      if(m_provider->m_closed) {
+        m_provider->closeWakeHandle();
+        return _return(nullptr);
+      }
+
+      provider::ResourceHandle<data::stream::IOStream> result;
+      std::list<provider::ResourceHandle<data::stream::IOStream>> extra;
+      bool wouldBlock = false;
+
+      for(v_int32 i = 0; i < ACCEPT_BATCH_SIZE; i ++) {
+
+#if defined(WIN32) || defined(_WIN32)
+        WSASetLastError(0);
+#else
+        errno = 0;
+#endif
+
+        auto connection = m_provider->acceptConnection();
+
+        if(!connection) {
+#if defined(WIN32) || defined(_WIN32)
+          wouldBlock = WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+          auto e = errno;
+          wouldBlock = ((e == EAGAIN) || (e == EINTR));
+#if EAGAIN != EWOULDBLOCK
+          wouldBlock = wouldBlock || (e == EWOULDBLOCK);
+#endif
+#endif
+          break;
+        }
+
+        if(result) {
+          extra.push_back(std::move(connection));
+        } else {
+          result = std::move(connection);
+        }
+
+      }
+
+      if(!extra.empty()) {
+        std::lock_guard<std::mutex> lock(m_provider->m_backlogMutex);
+        if(!m_provider->m_closed) {
+          m_provider->m_backlog.splice(m_provider->m_backlog.end(), extra);
+        }
+      }
+
+      if(result) {
+        return _return(result);
+      }
+
+      if(wouldBlock) {
+        return ioWait(m_provider->m_serverHandle, oatpp::async::Action::IOEventType::IO_EVENT_READ);
+      }
+
+      /* accept() failed - let the caller decide whether to retry, same as ConnectionProvider::get() */
+      return _return(nullptr);
+
+    }
+
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(m_backlogMutex);
+    if(!m_closed) {
+      m_asyncAccept = true;
+    }
   }
 
-  return getDefaultConnection();
+  return AcceptCoroutine::startForResult(this);
 
 }
 
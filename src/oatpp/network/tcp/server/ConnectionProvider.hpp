@@ -32,10 +32,17 @@
 
 #include "oatpp/Types.hpp"
 
+#include <list>
+#include <mutex>
+#include <vector>
+
 namespace oatpp { namespace network { namespace tcp { namespace server {
 
 /**
- * Simple provider of TCP connections.
+ * Simple provider of TCP connections. <br>
+ * To accept connections on several threads create several providers for the same address with `reusePort = true`
+ * and run a separate &id:oatpp::network::Server; for each of them - the kernel will spread incoming connections
+ * between the accepting sockets.
  */
 class ConnectionProvider : public ServerConnectionProvider {
 private:
@@ -47,6 +54,13 @@ private:
 
   };
 
+public:
+
+  /**
+   * Max number of connections accepted at once by &l:ConnectionProvider::getAsync ();.
+   */
+  static constexpr v_int32 ACCEPT_BATCH_SIZE = 16;
+
 public:
 
   /**
@@ -90,13 +104,24 @@ private:
   std::atomic<bool> m_closed;
   oatpp::v_io_handle m_serverHandle;
   bool m_useExtendedConnections;
+  bool m_reusePort;
   std::shared_ptr<ConnectionConfigurer> m_connectionConfigurer;
+private:
+  std::mutex m_backlogMutex;
+  std::list<provider::ResourceHandle<data::stream::IOStream>> m_backlog;
+  std::atomic<bool> m_asyncAccept;
+  oatpp::v_io_handle m_wakeHandle;
 private:
   oatpp::v_io_handle instantiateServer();
+  void closeServerHandle();
+  void wakeAcceptor();
+  void closeWakeHandle();
 private:
   void prepareConnectionHandle(oatpp::v_io_handle handle);
   provider::ResourceHandle<data::stream::IOStream> getDefaultConnection();
   provider::ResourceHandle<data::stream::IOStream> getExtendedConnection();
+  provider::ResourceHandle<data::stream::IOStream> acceptConnection();
+  provider::ResourceHandle<data::stream::IOStream> popBacklog();
 public:
 
   /**
@@ -104,8 +129,10 @@ public:
    * @param address - &id:oatpp::network::Address;.
    * @param useExtendedConnections - set `true` to use &l:ConnectionProvider::ExtendedConnection;.
    * `false` to use &id:oatpp::network::tcp::Connection;.
+   * @param reusePort - set `true` to set `SO_REUSEPORT` on the accepting socket,
+   * so that multiple providers can listen on the same address. Ignored on platforms without `SO_REUSEPORT`.
    */
-  ConnectionProvider(const network::Address& address, bool useExtendedConnections = false);
+  ConnectionProvider(const network::Address& address, bool useExtendedConnections = false, bool reusePort = false);
 
 public:
 
@@ -114,12 +141,34 @@ public:
    * @param address - &id:oatpp::network::Address;.
    * @param useExtendedConnections - set `true` to use &l:ConnectionProvider::ExtendedConnection;.
    * `false` to use &id:oatpp::network::tcp::Connection;.
+   * @param reusePort - set `true` to set `SO_REUSEPORT` on the accepting socket,
+   * so that multiple providers can listen on the same address. Ignored on platforms without `SO_REUSEPORT`.
    * @return - `std::shared_ptr` to ConnectionProvider.
    */
-  static std::shared_ptr<ConnectionProvider> createShared(const network::Address& address, bool useExtendedConnections = false){
-    return std::make_shared<ConnectionProvider>(address, useExtendedConnections);
+  static std::shared_ptr<ConnectionProvider> createShared(const network::Address& address,
+                                                          bool useExtendedConnections = false,
+                                                          bool reusePort = false)
+  {
+    return std::make_shared<ConnectionProvider>(address, useExtendedConnections, reusePort);
   }
 
+  /**
+   * Create a set of providers listening on the same address with `SO_REUSEPORT`. <br>
+   * Run a separate &id:oatpp::network::Server; for each of them - each with its own accept loop.
+   * The kernel spreads incoming connections between the accepting sockets. <br>
+   * To pin an accept loop to a core run it on a dedicated thread and use &id:oatpp::concurrency::Utils::setThreadAffinityToOneCpu;. <br>
+   * If `address.port` is `0` all providers listen on the port picked for the first one. <br>
+   * *Note: on platforms without `SO_REUSEPORT` only one provider can be created.*
+   * @param address - &id:oatpp::network::Address;.
+   * @param listenersCount - number of providers to create. At least one provider is created.
+   * @param useExtendedConnections - set `true` to use &l:ConnectionProvider::ExtendedConnection;.
+   * `false` to use &id:oatpp::network::tcp::Connection;.
+   * @return - `std::vector` of `std::shared_ptr` to ConnectionProvider.
+   */
+  static std::vector<std::shared_ptr<ConnectionProvider>> createListeners(const network::Address& address,
+                                                                          v_int32 listenersCount,
+                                                                          bool useExtendedConnections = false);
+
   /**
    * Set connection configurer.
    * @param connectionConfigurer
@@ -143,24 +192,15 @@ public:
   provider::ResourceHandle<data::stream::IOStream> get() override;
 
   /**
-   * No need to implement this.<br>
-   * For Asynchronous IO in oatpp it is considered to be a good practice
-   * to accept connections in a seperate thread with the blocking accept()
-   * and then process connections in Asynchronous manner with non-blocking read/write.
-   * <br>
-   * *It may be implemented later*
+   * Get incoming connection in Async manner. <br>
+   * Waits for the accept-socket to become readable on the &id:oatpp::async::worker::IOEventWorker;
+   * and then accepts up to &l:ConnectionProvider::ACCEPT_BATCH_SIZE; pending connections at once.
+   * Extra connections are handed out by the subsequent calls to &l:ConnectionProvider::get (); and &l:ConnectionProvider::getAsync ();. <br>
+   * Returns empty handle once the provider is stopped. <br>
+   * *Note: provider must outlive the coroutine. Only one coroutine should be waiting for the accept-socket at a time.*
+   * @return - &id:oatpp::async::CoroutineStarterForResult;.
    */
-  oatpp::async::CoroutineStarterForResult<const provider::ResourceHandle<data::stream::IOStream>&> getAsync() override {
-    /*
-     *  No need to implement this.
-     *  For Asynchronous IO in oatpp it is considered to be a good practice
-     *  to accept connections in a seperate thread with the blocking accept()
-     *  and then process connections in Asynchronous manner with non-blocking read/write
-     *
-     *  It may be implemented later
-     */
-    throw std::runtime_error("[oatpp::network::tcp::server::ConnectionProvider::getAsync()]: Error. Not implemented.");
-  }
+  oatpp::async::CoroutineStarterForResult<const provider::ResourceHandle<data::stream::IOStream>&> getAsync() override;
 
   /**
    * Get address - &id:oatpp::network::Address;.
@@ -27,10 +27,16 @@
 #define oatpp_provider_Pool_hpp
 
 #include "Provider.hpp"
+#include "Scheduler.hpp"
+
+#include "oatpp/async/Executor.hpp"
 #include "oatpp/async/CoroutineWaitList.hpp"
+#include "oatpp/async/utils/FrameAllocator.hpp"
 
 #include <thread>
 #include <condition_variable>
+#include <atomic>
+#include <vector>
 
 namespace oatpp { namespace provider {
 
@@ -97,6 +103,52 @@ private:
     v_int64 timestamp;
   };
 
+  /*
+   * Part of the bench with its own lock. <br>
+   * Records are used in LIFO order so that the most recently used (warm) resources are reused first.
+   */
+  struct Shard {
+    std::mutex lock;
+    std::vector<PoolRecord> bench;
+    /* keep locks of neighbouring shards on different cache lines */
+    char padding[64];
+  };
+
+  /*
+   * std-compatible allocator over &id:oatpp::async::utils::FrameAllocator;.
+   * Acquisition proxies are allocated with it so that memory of released proxies is recycled without touching the global heap.
+   */
+  template<class T>
+  class ProxyAllocator {
+  public:
+    typedef T value_type;
+  public:
+
+    ProxyAllocator() = default;
+
+    template<class U>
+    ProxyAllocator(const ProxyAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+      return static_cast<T*>(async::utils::FrameAllocator::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t) {
+      async::utils::FrameAllocator::deallocate(ptr);
+    }
+
+    template<class U>
+    bool operator == (const ProxyAllocator<U>&) const {
+      return true;
+    }
+
+    template<class U>
+    bool operator != (const ProxyAllocator<U>&) const {
+      return false;
+    }
+
+  };
+
 private:
 
   class ResourceInvalidator : public provider::Invalidator<TResource> {
@@ -116,164 +168,339 @@ private:
 
 private:
 
-  void onNewItem(async::CoroutineWaitList& list) override {
+  static v_uint32 getThreadIndex() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+    static std::atomic<v_uint32> threadsCounter(0);
+    static thread_local v_uint32 index = threadsCounter.fetch_add(1, std::memory_order_relaxed);
+    return index;
+#else
+    return static_cast<v_uint32>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+  }
 
-    std::unique_lock<std::mutex> guard(m_lock);
+  /*
+   * Pop the most recently released record. Starts with the shard of the calling thread and steals from other shards.
+   */
+  bool popRecord(PoolRecord& record) {
+    if(m_idleCount.load() == 0) {
+      return false;
+    }
+    auto start = getThreadIndex() % m_shardsCount;
+    for(v_uint32 i = 0; i < m_shardsCount; i ++) {
+      auto& shard = m_shards[(start + i) % m_shardsCount];
+      std::lock_guard<std::mutex> guard(shard.lock);
+      if(!shard.bench.empty()) {
+        record = std::move(shard.bench.back());
+        shard.bench.pop_back();
+        -- m_idleCount;
+        return true;
+      }
+    }
+    return false;
+  }
 
+  /*
+   * Put resource on the bench of the calling thread's shard.
+   * @return - `false` if the pool is stopped and the resource was not accepted.
+   */
+  bool pushRecord(provider::ResourceHandle<TResource>&& resource) {
+    auto& shard = m_shards[getThreadIndex() % m_shardsCount];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    /* checked under the shard lock - stop() clears shards after m_running is set to false */
     if(!m_running) {
-      guard.unlock();
-      list.notifyAll();
-      return;
+      return false;
     }
+    shard.bench.push_back({std::move(resource), oatpp::Environment::getMicroTickCount()});
+    ++ m_idleCount;
+    return true;
+  }
 
-    if(m_counter < m_maxResources || m_bench.size() > 0) {
-      guard.unlock();
-      list.notifyFirst();
+  bool hasRecords() {
+    return m_idleCount.load() > 0;
+  }
+
+  /*
+   * Reserve place for a new resource if the pool is not full.
+   */
+  bool tryReserve() {
+    auto counter = m_counter.load();
+    while(counter < m_maxResources) {
+      if(m_counter.compare_exchange_weak(counter, counter + 1)) {
+        return true;
+      }
     }
+    return false;
+  }
 
+  bool isReady() {
+    return !m_running || m_counter.load() < m_maxResources || hasRecords();
   }
 
-  void release(provider::ResourceHandle<TResource>&& resource, bool canReuse) {
+  /*
+   * Wake one waiter (if any) after a resource was put on the bench or the counter was decremented.
+   */
+  void notifyWaiters() {
+    if(m_waiters.load() > 0) {
+      {
+        /* waiter checks the pool state and goes to wait under this lock */
+        std::lock_guard<std::mutex> guard(m_lock);
+      }
+      m_condition.notify_one();
+    }
+    if(m_asyncWaiters.load() > 0) {
+      m_waitList.notifyFirst();
+    }
+  }
 
-    {
+  provider::ResourceHandle<TResource> createProxy(const provider::ResourceHandle<TResource>& resource,
+                                                  const std::shared_ptr<PoolTemplate>& pool)
+  {
+    return provider::ResourceHandle<TResource>(
+      std::allocate_shared<AcquisitionProxyImpl>(ProxyAllocator<AcquisitionProxyImpl>(), resource, pool),
+      m_invalidator
+    );
+  }
 
-      std::lock_guard<std::mutex> guard(m_lock);
+  void onNewItem(async::CoroutineWaitList& list) override {
 
-      if(!m_running) {
-        -- m_counter;
-        return;
-      }
+    if(!m_running) {
+      list.notifyAll();
+      return;
+    }
 
-      if(canReuse) {
-        m_bench.push_back({resource, oatpp::Environment::getMicroTickCount()});
-      } else {
-        -- m_counter;
-      }
+    if(m_counter.load() < m_maxResources || hasRecords()) {
+      list.notifyFirst();
+    }
+
+  }
 
+  void release(provider::ResourceHandle<TResource>&& resource, bool canReuse) {
+
+    if(!canReuse || !pushRecord(std::move(resource))) {
+      -- m_counter;
     }
 
-    m_condition.notify_one();
-    m_waitList.notifyFirst();
+    notifyWaiters();
 
   }
 
 private:
 
-  static void cleanupTask(std::shared_ptr<PoolTemplate> pool) {
+  class WarmUpCoroutine : public async::Coroutine<WarmUpCoroutine> {
+  private:
+    std::shared_ptr<PoolTemplate> m_pool;
+  public:
 
-    while(pool->m_running) { // timer-based cleanup loop
+    WarmUpCoroutine(const std::shared_ptr<PoolTemplate>& pool)
+      : m_pool(pool)
+    {}
 
-      {
-        std::lock_guard<std::mutex> guard(pool->m_lock);
-        auto ticks = oatpp::Environment::getMicroTickCount();
+    async::Action act() override {
+      return m_pool->m_provider->getAsync().callbackTo(&WarmUpCoroutine::onResource);
+    }
 
-        auto i = pool->m_bench.begin();
-        while (i != pool->m_bench.end()) {
+    async::Action onResource(const provider::ResourceHandle<TResource>& resource) {
+      -- m_pool->m_warmingCount;
+      if(!resource) {
+        OATPP_LOGW("[oatpp::provider::PoolTemplate::WarmUpCoroutine]", "Warning. Provider returned empty resource.")
+        -- m_pool->m_counter;
+        m_pool->notifyWaiters();
+        return this->finish();
+      }
+      m_pool->release(provider::ResourceHandle<TResource>(resource), true);
+      return this->finish();
+    }
 
-          auto elapsed = ticks - i->timestamp;
-          if(elapsed > pool->m_maxResourceTTL) {
-            i->resource.invalidator->invalidate(i->resource.object);
-            i = pool->m_bench.erase(i);
-            pool->m_counter --;
-          } else {
-            i ++;
-          }
+    async::Action handleError(oatpp::async::Error* error) override {
+      OATPP_LOGW("[oatpp::provider::PoolTemplate::WarmUpCoroutine]", "Warning. Can't create resource: %s", error->what())
+      -- m_pool->m_warmingCount;
+      -- m_pool->m_counter;
+      m_pool->notifyWaiters();
+      return error;
+    }
 
-        }
+  };
 
-      }
+  /*
+   * Asynchronously create resources until there are at least `minIdle` resources on the bench (or on the way to it).
+   */
+  void warmUp() {
+
+    auto minIdle = m_minIdle.load();
+    if(minIdle == 0 || m_idleCount.load() + m_warmingCount.load() >= minIdle) {
+      return;
+    }
 
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::lock_guard<std::mutex> guard(m_lock);
+    auto pool = m_self.lock();
+    if(!m_running || !pool || !m_warmUpExecutor) {
+      return;
+    }
 
+    while(m_idleCount.load() + m_warmingCount.load() < minIdle && tryReserve()) {
+      ++ m_warmingCount;
+      m_warmUpExecutor->execute<WarmUpCoroutine>(pool);
     }
 
-    { /* invalidate all pooled resources */
+  }
+
+  /*
+   * Invalidate resources which stayed on the bench longer than `maxResourceTTL`. <br>
+   * Bench of a shard is ordered by the release time, so only its beginning is checked.
+   * At least `minIdle` resources are kept.
+   */
+  void evictExpired() {
+
+    auto ticks = oatpp::Environment::getMicroTickCount();
+    auto minIdle = m_minIdle.load();
+    v_int64 evicted = 0;
 
-      std::lock_guard<std::mutex> guard(pool->m_lock);
-      auto i = pool->m_bench.begin();
-      while (i != pool->m_bench.end()) {
+    for(v_uint32 s = 0; s < m_shardsCount; s ++) {
+
+      auto& shard = m_shards[s];
+      std::lock_guard<std::mutex> guard(shard.lock);
+
+      auto i = shard.bench.begin();
+      while (i != shard.bench.end() && ticks - i->timestamp > m_maxResourceTTL && m_idleCount.load() > minIdle) {
         i->resource.invalidator->invalidate(i->resource.object);
-        i = pool->m_bench.erase(i);
-        pool->m_counter --;
+        -- m_idleCount;
+        -- m_counter;
+        ++ evicted;
+        i ++;
       }
+      shard.bench.erase(shard.bench.begin(), i);
 
-      pool->m_finished = true;
+    }
 
+    if(evicted > 0) {
+      notifyWaiters();
     }
 
-    pool->m_condition.notify_all();
+  }
 
+  /* remove all pooled resources */
+  void clearShards(bool invalidate) {
+    for(v_uint32 s = 0; s < m_shardsCount; s ++) {
+      auto& shard = m_shards[s];
+      std::lock_guard<std::mutex> guard(shard.lock);
+      if(invalidate) {
+        for(auto& record : shard.bench) {
+          record.resource.invalidator->invalidate(record.resource.object);
+        }
+      }
+      m_counter -= static_cast<v_int64>(shard.bench.size());
+      m_idleCount -= static_cast<v_int64>(shard.bench.size());
+      shard.bench.clear();
+    }
   }
 
 private:
   std::shared_ptr<ResourceInvalidator> m_invalidator;
   std::shared_ptr<Provider<TResource>> m_provider;
-  v_int64 m_counter{0};
+  std::atomic<v_int64> m_counter{0};
   v_int64 m_maxResources;
   v_int64 m_maxResourceTTL;
   std::atomic<bool> m_running{true};
-  bool m_finished{false};
 private:
-  std::list<PoolRecord> m_bench;
+  std::unique_ptr<Shard[]> m_shards;
+  v_uint32 m_shardsCount;
+  std::atomic<v_int64> m_idleCount{0};
+  std::atomic<v_int64> m_warmingCount{0};
+  std::atomic<v_int64> m_minIdle{0};
+  std::shared_ptr<async::Executor> m_warmUpExecutor;
+  std::weak_ptr<PoolTemplate> m_self;
+  std::atomic<v_int64> m_waiters{0};
+  std::atomic<v_int64> m_asyncWaiters{0};
   async::CoroutineWaitList m_waitList;
   std::condition_variable m_condition;
   std::mutex m_lock;
   std::chrono::duration<v_int64, std::micro> m_timeout;
 protected:
 
-  PoolTemplate(const std::shared_ptr<Provider<TResource>>& provider, v_int64 maxResources, v_int64 maxResourceTTL, const std::chrono::duration<v_int64, std::micro>& timeout)
+  PoolTemplate(const std::shared_ptr<Provider<TResource>>& provider,
+               v_int64 maxResources,
+               v_int64 maxResourceTTL,
+               const std::chrono::duration<v_int64, std::micro>& timeout,
+               v_uint32 shardsCount = 1)
     : m_invalidator(std::make_shared<ResourceInvalidator>())
     , m_provider(provider)
     , m_maxResources(maxResources)
     , m_maxResourceTTL(maxResourceTTL)
+    , m_shards(new Shard[shardsCount > 0 ? shardsCount : 1])
+    , m_shardsCount(shardsCount > 0 ? shardsCount : 1)
     , m_timeout(timeout)
-  {}
+  {
+    m_waitList.setListener(this);
+  }
 
+  /*
+   * Register TTL eviction and pre-warming of the pool in the shared &id:oatpp::provider::Scheduler;.
+   * The scheduler doesn't prolong the pool lifetime.
+   */
   static void startCleanupTask(const std::shared_ptr<PoolTemplate>& _this) {
-    std::thread poolCleanupTask(cleanupTask, _this);
-    poolCleanupTask.detach();
+    _this->m_self = _this;
+    std::weak_ptr<PoolTemplate> weakPool = _this;
+    Scheduler::schedule(std::chrono::milliseconds(100), [weakPool]() {
+      auto pool = weakPool.lock();
+      if(!pool || !pool->m_running) {
+        return false;
+      }
+      pool->evictExpired();
+      pool->warmUp();
+      return true;
+    });
   }
 
   static provider::ResourceHandle<TResource> get(const std::shared_ptr<PoolTemplate>& _this) {
-    auto readyPredicate = [&_this]() { return !_this->m_running || !_this->m_bench.empty() || _this->m_counter < _this->m_maxResources; };
 
-    std::unique_lock<std::mutex> guard{_this->m_lock};
-    if (_this->m_timeout == std::chrono::microseconds::zero())
-    {
-      while (!readyPredicate()) {
-        _this->m_condition.wait(guard);
+    auto startTime = std::chrono::steady_clock::now();
+
+    while(true) {
+
+      if(!_this->m_running) {
+        return nullptr;
       }
-    } else if (!_this->m_condition.wait_for(guard, _this->m_timeout, std::move(readyPredicate))) {
-      return nullptr;
-    }    
 
-    if(!_this->m_running) {
-      return nullptr;
-    }
+      PoolRecord record;
+      if(_this->popRecord(record)) {
+        _this->warmUp();
+        return _this->createProxy(record.resource, _this);
+      }
 
-    if (_this->m_bench.size() > 0) {
-      auto record = _this->m_bench.front();
-      _this->m_bench.pop_front();
-      return provider::ResourceHandle<TResource>(
-        std::make_shared<AcquisitionProxyImpl>(record.resource, _this),
-        _this->m_invalidator
-      );
-    } else {
-      ++ _this->m_counter;
-    }
+      if(_this->tryReserve()) {
+        _this->warmUp();
+        break;
+      }
 
-    guard.unlock();
+      std::unique_lock<std::mutex> guard{_this->m_lock};
+      ++ _this->m_waiters;
+      bool ready = _this->isReady();
+      if(!ready) {
+        if (_this->m_timeout == std::chrono::microseconds::zero()) {
+          _this->m_condition.wait(guard);
+          ready = true;
+        } else if(_this->m_condition.wait_until(guard, startTime + _this->m_timeout) == std::cv_status::timeout) {
+          ready = _this->isReady();
+        } else {
+          ready = true;
+        }
+      }
+      -- _this->m_waiters;
+
+      if(!ready) {
+        return nullptr;
+      }
+
+    }
 
     try {
-      return provider::ResourceHandle<TResource>(
-        std::make_shared<AcquisitionProxyImpl>(_this->m_provider->get(), _this),
-        _this->m_invalidator
-      );
+      return _this->createProxy(_this->m_provider->get(), _this);
     } catch (...) {
-      guard.lock();
-      --_this->m_counter;
+      -- _this->m_counter;
+      _this->notifyWaiters();
       return nullptr;
     }
+
   }
 
   static async::CoroutineStarterForResult<const provider::ResourceHandle<TResource>&> getAsync(const std::shared_ptr<PoolTemplate>& _this) {
@@ -282,67 +509,65 @@ protected:
     private:
       std::shared_ptr<PoolTemplate> m_pool;
       std::chrono::system_clock::time_point m_startTime{std::chrono::system_clock::now()};
+      bool m_waiting{false};
+    private:
+
+      void stopWaiting() {
+        if(m_waiting) {
+          m_waiting = false;
+          -- m_pool->m_asyncWaiters;
+        }
+      }
+
     public:
 
       GetCoroutine(const std::shared_ptr<PoolTemplate>& pool)
         : m_pool(pool)
       {}
 
+      ~GetCoroutine() override {
+        stopWaiting();
+      }
+
       bool timedout() const noexcept {
         return m_pool->m_timeout != std::chrono::microseconds::zero() && m_pool->m_timeout < (std::chrono::system_clock::now() - m_startTime);
       }
 
       async::Action act() override {
-        
-        if (timedout()) return this->_return(nullptr);
-
-        {
-          /* Careful!!! Using non-async lock */
-          std::unique_lock<std::mutex> guard(m_pool->m_lock);
-
-          if (m_pool->m_running && m_pool->m_bench.size() == 0 && m_pool->m_counter >= m_pool->m_maxResources) {
-            guard.unlock();
-            return m_pool->m_timeout == std::chrono::microseconds::zero()
-              ? async::Action::createWaitListAction(&m_pool->m_waitList)
-              : async::Action::createWaitListAction(&m_pool->m_waitList, m_startTime + m_pool->m_timeout);
-          }
-
-          if(!m_pool->m_running) {
-            guard.unlock();
-            return this->_return(nullptr);
-          }
-
-          if (m_pool->m_bench.size() > 0) {
-            auto record = m_pool->m_bench.front();
-            m_pool->m_bench.pop_front();
-            guard.unlock();
-            return this->_return(provider::ResourceHandle<TResource>(
-              std::make_shared<AcquisitionProxyImpl>(record.resource, m_pool),
-              m_pool->m_invalidator
-            ));
-          } else {
-            ++ m_pool->m_counter;
-          }
 
+        stopWaiting();
+
+        if (timedout() || !m_pool->m_running) {
+          return this->_return(nullptr);
         }
 
-        return m_pool->m_provider->getAsync().callbackTo(&GetCoroutine::onGet);
+        PoolRecord record;
+        if(m_pool->popRecord(record)) {
+          m_pool->warmUp();
+          return this->_return(m_pool->createProxy(record.resource, m_pool));
+        }
+
+        if(m_pool->tryReserve()) {
+          m_pool->warmUp();
+          return m_pool->m_provider->getAsync().callbackTo(&GetCoroutine::onGet);
+        }
+
+        /* pool state is checked again in onNewItem() when the coroutine is put on the wait-list */
+        m_waiting = true;
+        ++ m_pool->m_asyncWaiters;
+        return m_pool->m_timeout == std::chrono::microseconds::zero()
+          ? async::Action::createWaitListAction(&m_pool->m_waitList)
+          : async::Action::createWaitListAction(&m_pool->m_waitList, m_startTime + m_pool->m_timeout);
 
       }
 
       async::Action onGet(const provider::ResourceHandle<TResource>& resource) {
-        return this->_return(provider::ResourceHandle<TResource>(
-          std::make_shared<AcquisitionProxyImpl>(resource, m_pool),
-          m_pool->m_invalidator
-        ));
+        return this->_return(m_pool->createProxy(resource, m_pool));
       }
 
       async::Action handleError(oatpp::async::Error* error) override {
-        {
-          /* Careful!!! Using non-async lock */
-          std::lock_guard<std::mutex> guard(m_pool->m_lock);
-          -- m_pool->m_counter;
-        }
+        -- m_pool->m_counter;
+        m_pool->notifyWaiters();
         return error;
       }
 
@@ -357,10 +582,11 @@ public:
   static std::shared_ptr<PoolTemplate> createShared(const std::shared_ptr<Provider<TResource>>& provider,
                                                     v_int64 maxResources,
                                                     const std::chrono::duration<v_int64, std::micro>& maxResourceTTL,
-                                                    const std::chrono::duration<v_int64, std::micro>& timeout)
+                                                    const std::chrono::duration<v_int64, std::micro>& timeout,
+                                                    v_uint32 shardsCount = 1)
   {
     /* "new" is called directly to keep constructor private */
-    auto ptr = std::shared_ptr<PoolTemplate>(new PoolTemplate(provider, maxResources, maxResourceTTL.count(), timeout));
+    auto ptr = std::shared_ptr<PoolTemplate>(new PoolTemplate(provider, maxResources, maxResourceTTL.count(), timeout, shardsCount));
     startCleanupTask(ptr);
     return ptr;
   }
@@ -379,28 +605,45 @@ public:
       }
 
       m_running = false;
-      m_counter -= static_cast<v_int64>(m_bench.size());
-      m_bench.clear();
     }
 
+    clearShards(false);
+
     m_condition.notify_all();
     m_waitList.notifyAll();
 
-    {
-      std::unique_lock<std::mutex> guard(m_lock);
-      while (!m_finished) {
-        m_condition.wait(guard);
-      }
-
-    }
-
     m_provider->stop();
 
   }
 
+  /**
+   * Keep at least `minIdle` resources ready in the pool. <br>
+   * Missing resources are created ahead of demand with &id:oatpp::provider::Provider::getAsync (); on the given executor:
+   * right away, when resources are taken from the pool, and periodically - after TTL eviction.
+   * TTL eviction never leaves less than `minIdle` resources in the pool. <br>
+   * The number of resources is still limited by `maxResources`.
+   * @param minIdle - min number of idle resources. `0` - disable pre-warming.
+   * @param executor - &id:oatpp::async::Executor; to run resource creation on.
+   */
+  void setMinIdle(v_int64 minIdle, const std::shared_ptr<async::Executor>& executor) {
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_warmUpExecutor = executor;
+      m_minIdle = minIdle;
+    }
+    warmUp();
+  }
+
   v_int64 getCounter() {
-    std::lock_guard<std::mutex> guard(m_lock);
-    return m_counter;
+    return m_counter.load();
+  }
+
+  /**
+   * Get number of idle resources in the pool.
+   * @return
+   */
+  v_int64 getIdleCount() {
+    return m_idleCount.load();
   }
 
 };
@@ -426,13 +669,15 @@ protected:
    * @param maxResources
    * @param maxResourceTTL
    * @param timeout
+   * @param shardsCount
    */
   Pool(const std::shared_ptr<TProvider>& provider,
        v_int64 maxResources,
        v_int64 maxResourceTTL,
-       const std::chrono::duration<v_int64, std::micro>& timeout = std::chrono::microseconds::zero()
+       const std::chrono::duration<v_int64, std::micro>& timeout = std::chrono::microseconds::zero(),
+       v_uint32 shardsCount = 1
   )
-    : PoolTemplate<TResource, AcquisitionProxyImpl>(provider, maxResources, maxResourceTTL, timeout)
+    : PoolTemplate<TResource, AcquisitionProxyImpl>(provider, maxResources, maxResourceTTL, timeout, shardsCount)
   {
     TProvider::m_properties = provider->getProperties();
   }
@@ -445,15 +690,19 @@ public:
    * @param maxResources - max resource count in the pool.
    * @param maxResourceTTL - max time-to-live for unused resource in the pool.
    * @param timeout - optional timeout on &l:TestPool::get (); and &l:TestPool::getAsync (); operations.
+   * @param shardsCount - number of independently locked parts of the pool bench. Threads put and take resources
+   * from their own shard and steal from other shards when their own is empty. <br>
+   * Use `1` (default) for lightly loaded pools and about the number of CPU cores for pools hit by many threads.
    * @return - `std::shared_ptr` of `TestPool`.
    */
   static std::shared_ptr<Pool> createShared(const std::shared_ptr<TProvider>& provider,
                                             v_int64 maxResources,
                                             const std::chrono::duration<v_int64, std::micro>& maxResourceTTL,
-                                            const std::chrono::duration<v_int64, std::micro>& timeout = std::chrono::microseconds::zero())
+                                            const std::chrono::duration<v_int64, std::micro>& timeout = std::chrono::microseconds::zero(),
+                                            v_uint32 shardsCount = 1)
   {
     /* "new" is called directly to keep constructor private */
-    auto ptr = std::shared_ptr<Pool>(new Pool(provider, maxResources, maxResourceTTL.count(), timeout));
+    auto ptr = std::shared_ptr<Pool>(new Pool(provider, maxResources, maxResourceTTL.count(), timeout, shardsCount));
     ptr->startCleanupTask(ptr);
     return ptr;
   }
@@ -0,0 +1,158 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>,
+ * Matthias Haselmaier <mhaselmaier@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Scheduler.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace provider {
+
+namespace {
+
+struct ScheduledTask {
+  std::chrono::steady_clock::time_point nextRun;
+  std::chrono::duration<v_int64, std::micro> interval;
+  Scheduler::Task task;
+};
+
+class SchedulerThread {
+private:
+  std::mutex m_lock;
+  std::condition_variable m_condition;
+  std::vector<ScheduledTask> m_tasks;
+  v_int64 m_runningTasks{0};
+  bool m_started{false};
+private:
+
+  void run() {
+
+    std::vector<ScheduledTask> due;
+    std::unique_lock<std::mutex> guard(m_lock);
+
+    while(true) {
+
+      if(m_tasks.empty()) {
+        m_condition.wait(guard);
+        continue;
+      }
+
+      auto now = std::chrono::steady_clock::now();
+      auto nextRun = m_tasks.front().nextRun;
+      for(auto& task : m_tasks) {
+        if(task.nextRun < nextRun) {
+          nextRun = task.nextRun;
+        }
+      }
+
+      if(nextRun > now) {
+        m_condition.wait_until(guard, nextRun);
+        continue;
+      }
+
+      auto i = m_tasks.begin();
+      while(i != m_tasks.end()) {
+        if(i->nextRun <= now) {
+          due.push_back(std::move(*i));
+          i = m_tasks.erase(i);
+        } else {
+          i ++;
+        }
+      }
+
+      m_runningTasks = static_cast<v_int64>(due.size());
+      guard.unlock();
+
+      /* tasks are run without the lock - they may schedule new tasks */
+      auto t = due.begin();
+      while(t != due.end()) {
+        bool keep = true;
+        try {
+          keep = t->task();
+        } catch (std::exception& e) {
+          OATPP_LOGE("[oatpp::provider::Scheduler::run()]", "Error. Task failed: %s", e.what())
+        } catch (...) {
+          OATPP_LOGE("[oatpp::provider::Scheduler::run()]", "Error. Task failed with unknown error.")
+        }
+        if(keep) {
+          t->nextRun = std::chrono::steady_clock::now() + t->interval;
+          t ++;
+        } else {
+          t = due.erase(t);
+        }
+      }
+
+      guard.lock();
+      for(auto& task : due) {
+        m_tasks.push_back(std::move(task));
+      }
+      due.clear();
+      m_runningTasks = 0;
+
+    }
+
+  }
+
+public:
+
+  void schedule(const std::chrono::duration<v_int64, std::micro>& interval, const Scheduler::Task& task) {
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_tasks.push_back({std::chrono::steady_clock::now() + interval, interval, task});
+      if(!m_started) {
+        m_started = true;
+        std::thread thread(&SchedulerThread::run, this);
+        thread.detach();
+      }
+    }
+    m_condition.notify_one();
+  }
+
+  v_int64 getTasksCount() {
+    std::lock_guard<std::mutex> guard(m_lock);
+    return static_cast<v_int64>(m_tasks.size()) + m_runningTasks;
+  }
+
+};
+
+/* never destroyed - the thread is detached and runs till the process exit */
+SchedulerThread& getSchedulerThread() {
+  static SchedulerThread* thread = new SchedulerThread();
+  return *thread;
+}
+
+}
+
+void Scheduler::schedule(const std::chrono::duration<v_int64, std::micro>& interval, const Task& task) {
+  getSchedulerThread().schedule(interval, task);
+}
+
+v_int64 Scheduler::getTasksCount() {
+  return getSchedulerThread().getTasksCount();
+}
+
+}}
@@ -0,0 +1,68 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>,
+ * Matthias Haselmaier <mhaselmaier@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_provider_Scheduler_hpp
+#define oatpp_provider_Scheduler_hpp
+
+#include "oatpp/Environment.hpp"
+
+#include <chrono>
+#include <functional>
+
+namespace oatpp { namespace provider {
+
+/**
+ * Process-wide scheduler of periodic maintenance tasks - TTL eviction and pre-warming of &id:oatpp::provider::PoolTemplate;. <br>
+ * All tasks run on one shared thread which is started when the first task is scheduled.
+ * Tasks must be short and must not block.
+ */
+class Scheduler {
+public:
+
+  /**
+   * Periodic task. Return `false` to remove the task from the scheduler.
+   */
+  typedef std::function<bool()> Task;
+
+public:
+
+  /**
+   * Schedule periodic task. The first run happens after `interval`.
+   * @param interval - interval between runs.
+   * @param task - &l:Scheduler::Task;.
+   */
+  static void schedule(const std::chrono::duration<v_int64, std::micro>& interval, const Task& task);
+
+  /**
+   * Get number of scheduled tasks.
+   * @return
+   */
+  static v_int64 getTasksCount();
+
+};
+
+}}
+
+#endif // oatpp_provider_Scheduler_hpp
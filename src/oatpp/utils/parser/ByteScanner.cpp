@@ -0,0 +1,194 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ByteScanner.hpp"
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+  #define OATPP_BYTE_SCANNER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define OATPP_BYTE_SCANNER_SSE2
+#endif
+
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+namespace oatpp { namespace utils { namespace parser {
+
+namespace {
+
+inline v_buff_size countTrailingZeros(v_uint32 mask) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<v_buff_size>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+#if defined(OATPP_BYTE_SCANNER_AVX2)
+
+  typedef __m256i Vector;
+  constexpr v_buff_size VECTOR_SIZE = 32;
+
+  inline Vector load(const char* data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  }
+
+  inline Vector splat(char c) {
+    return _mm256_set1_epi8(c);
+  }
+
+  inline Vector equal(Vector a, Vector b) {
+    return _mm256_cmpeq_epi8(a, b);
+  }
+
+  inline Vector bitOr(Vector a, Vector b) {
+    return _mm256_or_si256(a, b);
+  }
+
+  inline Vector bitAnd(Vector a, Vector b) {
+    return _mm256_and_si256(a, b);
+  }
+
+  inline v_uint32 toMask(Vector v) {
+    return static_cast<v_uint32>(_mm256_movemask_epi8(v));
+  }
+
+#elif defined(OATPP_BYTE_SCANNER_SSE2)
+
+  typedef __m128i Vector;
+  constexpr v_buff_size VECTOR_SIZE = 16;
+
+  inline Vector load(const char* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+
+  inline Vector splat(char c) {
+    return _mm_set1_epi8(c);
+  }
+
+  inline Vector equal(Vector a, Vector b) {
+    return _mm_cmpeq_epi8(a, b);
+  }
+
+  inline Vector bitOr(Vector a, Vector b) {
+    return _mm_or_si128(a, b);
+  }
+
+  inline Vector bitAnd(Vector a, Vector b) {
+    return _mm_and_si128(a, b);
+  }
+
+  inline v_uint32 toMask(Vector v) {
+    return static_cast<v_uint32>(_mm_movemask_epi8(v));
+  }
+
+#endif
+
+}
+
+v_buff_size ByteScanner::findCharFromPair(const char* data, v_buff_size size, char a, char b) {
+
+  v_buff_size i = 0;
+
+#if defined(OATPP_BYTE_SCANNER_AVX2) || defined(OATPP_BYTE_SCANNER_SSE2)
+  const Vector va = splat(a);
+  const Vector vb = splat(b);
+  for(; i + VECTOR_SIZE <= size; i += VECTOR_SIZE) {
+    Vector chunk = load(data + i);
+    auto mask = toMask(bitOr(equal(chunk, va), equal(chunk, vb)));
+    if(mask != 0) {
+      return i + countTrailingZeros(mask);
+    }
+  }
+#endif
+
+  for(; i < size; i ++) {
+    if(data[i] == a || data[i] == b) {
+      return i;
+    }
+  }
+
+  return -1;
+
+}
+
+v_buff_size ByteScanner::findRN(const char* data, v_buff_size size) {
+
+  v_buff_size i = 0;
+
+#if defined(OATPP_BYTE_SCANNER_AVX2) || defined(OATPP_BYTE_SCANNER_SSE2)
+  const Vector vr = splat('\r');
+  const Vector vn = splat('\n');
+  for(; i + VECTOR_SIZE + 1 <= size; i += VECTOR_SIZE) {
+    auto mask = toMask(bitAnd(equal(load(data + i), vr), equal(load(data + i + 1), vn)));
+    if(mask != 0) {
+      return i + countTrailingZeros(mask);
+    }
+  }
+#endif
+
+  for(; i + 1 < size; i ++) {
+    if(data[i] == '\r' && data[i + 1] == '\n') {
+      return i;
+    }
+  }
+
+  return -1;
+
+}
+
+v_buff_size ByteScanner::findRNRN(const char* data, v_buff_size size) {
+
+  v_buff_size i = 0;
+
+#if defined(OATPP_BYTE_SCANNER_AVX2) || defined(OATPP_BYTE_SCANNER_SSE2)
+  const Vector vr = splat('\r');
+  const Vector vn = splat('\n');
+  for(; i + VECTOR_SIZE + 3 <= size; i += VECTOR_SIZE) {
+    Vector rn0 = bitAnd(equal(load(data + i), vr), equal(load(data + i + 1), vn));
+    Vector rn2 = bitAnd(equal(load(data + i + 2), vr), equal(load(data + i + 3), vn));
+    auto mask = toMask(bitAnd(rn0, rn2));
+    if(mask != 0) {
+      return i + countTrailingZeros(mask);
+    }
+  }
+#endif
+
+  for(; i + 3 < size; i ++) {
+    if(data[i] == '\r' && data[i + 1] == '\n' && data[i + 2] == '\r' && data[i + 3] == '\n') {
+      return i;
+    }
+  }
+
+  return -1;
+
+}
+
+}}}
@@ -0,0 +1,70 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_utils_parser_ByteScanner_hpp
+#define oatpp_utils_parser_ByteScanner_hpp
+
+#include "oatpp/Types.hpp"
+
+namespace oatpp { namespace utils { namespace parser {
+
+/**
+ * Vectorized search of bytes in the buffer. <br>
+ * Uses AVX2 if the library is compiled with AVX2 enabled (`-mavx2`), SSE2 on x86/x86-64, scalar loop otherwise.
+ */
+class ByteScanner {
+public:
+
+  /**
+   * Find first occurrence of any of two chars.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   * @param a - first char.
+   * @param b - second char.
+   * @return - index of the found char or `-1` if not found.
+   */
+  static v_buff_size findCharFromPair(const char* data, v_buff_size size, char a, char b);
+
+  /**
+   * Find first occurrence of `\r\n`.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   * @return - index of `\r` or `-1` if not found.
+   */
+  static v_buff_size findRN(const char* data, v_buff_size size);
+
+  /**
+   * Find first occurrence of `\r\n\r\n` - end of HTTP headers section.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   * @return - index of the first `\r` or `-1` if not found.
+   */
+  static v_buff_size findRNRN(const char* data, v_buff_size size);
+
+};
+
+}}}
+
+#endif // oatpp_utils_parser_ByteScanner_hpp
@@ -38,6 +38,137 @@
 
 namespace oatpp { namespace web { namespace client {
 
+namespace {
+
+/*
+ * Decoder for response bodies which were already read from the pipelined connection and decoded.
+ * Bodies are stored in memory, so it just copies the data.
+ */
+class PreloadedBodyDecoder : public protocol::http::incoming::BodyDecoder {
+public:
+
+  void decode(const protocol::http::Headers& headers,
+              data::stream::InputStream* bodyStream,
+              data::stream::WriteCallback* writeCallback,
+              data::stream::IOStream* connection) const override
+  {
+    (void) headers;
+    (void) connection;
+    data::buffer::IOBuffer buffer;
+    data::stream::transfer(bodyStream, writeCallback, 0 /* read until error */, buffer.getData(), buffer.getSize());
+  }
+
+  oatpp::async::CoroutineStarter decodeAsync(const protocol::http::Headers& headers,
+                                             const std::shared_ptr<data::stream::InputStream>& bodyStream,
+                                             const std::shared_ptr<data::stream::WriteCallback>& writeCallback,
+                                             const std::shared_ptr<data::stream::IOStream>& connection) const override
+  {
+    (void) headers;
+    (void) connection;
+    return data::stream::transferAsync(bodyStream, writeCallback, 0 /* read until error */, data::buffer::IOBuffer::createShared());
+  }
+
+};
+
+/*
+ * Collects pipelined response body in memory. Throws once the body grows over the limit -
+ * the rest of the body is left unread, so the connection can't be used anymore.
+ */
+class PipelinedBodyBuffer : public data::stream::WriteCallback {
+private:
+  data::stream::BufferOutputStream m_buffer;
+  v_buff_size m_maxSize;
+public:
+
+  PipelinedBodyBuffer(v_buff_size maxSize)
+    : m_maxSize(maxSize)
+  {}
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    if(m_buffer.getCurrentPosition() + count > m_maxSize) {
+      throw std::runtime_error("[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Error. Response body exceeds max body size.");
+    }
+    return m_buffer.write(data, count, action);
+  }
+
+  oatpp::String toString() {
+    return m_buffer.toString();
+  }
+
+};
+
+/*
+ * Pass-through output stream which remembers failed writes.
+ * Buffered proxy flush doesn't report errors of the underlying stream.
+ */
+class SendErrorTracker : public data::stream::OutputStream {
+private:
+  std::shared_ptr<data::stream::OutputStream> m_stream;
+  bool m_failed;
+public:
+
+  SendErrorTracker(const std::shared_ptr<data::stream::OutputStream>& stream)
+    : m_stream(stream)
+    , m_failed(false)
+  {}
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    auto res = m_stream->write(data, count, action);
+    if(res <= 0 && res != IOError::RETRY_READ && res != IOError::RETRY_WRITE) {
+      m_failed = true;
+    }
+    return res;
+  }
+
+  void setOutputStreamIOMode(data::stream::IOMode ioMode) override {
+    m_stream->setOutputStreamIOMode(ioMode);
+  }
+
+  data::stream::IOMode getOutputStreamIOMode() override {
+    return m_stream->getOutputStreamIOMode();
+  }
+
+  data::stream::Context& getOutputStreamContext() override {
+    return m_stream->getOutputStreamContext();
+  }
+
+  bool hasFailed() const {
+    return m_failed;
+  }
+
+};
+
+bool responseHasBody(const oatpp::String& method, v_int32 statusCode) {
+  if(data::share::StringKeyLabelCI(method) == "HEAD") {
+    return false;
+  }
+  return !((statusCode >= 100 && statusCode < 200) || statusCode == 204 || statusCode == 304);
+}
+
+/*
+ * Fail pipelined request at `index` with the error given, and all requests queued after it with NO_RESPONSE.
+ */
+void failPipelinedRequests(std::vector<HttpRequestExecutor::PipelinedResponse>& responses,
+                           size_t index,
+                           v_int32 errorCode,
+                           const oatpp::String& errorMessage)
+{
+  typedef RequestExecutor::RequestExecutionError RequestExecutionError;
+  for(size_t i = index; i < responses.size(); i ++) {
+    auto& response = responses[i];
+    response.response = nullptr;
+    if(i == index) {
+      response.errorCode = errorCode;
+      response.errorMessage = errorMessage;
+    } else {
+      response.errorCode = RequestExecutionError::ERROR_CODE_NO_RESPONSE;
+      response.errorMessage = "[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Error. Pipelined connection closed before response was received.";
+    }
+  }
+}
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // HttpRequestExecutor::ConnectionProxy
 
@@ -168,6 +299,24 @@ HttpRequestExecutor::getConnectionAsync() {
   
 }
 
+std::shared_ptr<HttpRequestExecutor::OutgoingRequest>
+HttpRequestExecutor::createRequest(const String& method,
+                                   const String& path,
+                                   const Headers& headers,
+                                   const std::shared_ptr<Body>& body)
+{
+  auto request = OutgoingRequest::createShared(method, path, headers, body);
+  oatpp::data::stream::BufferOutputStream hostValue;
+  hostValue << m_connectionProvider->getProperty("host").toString();
+  auto port = m_connectionProvider->getProperty("port");
+  if(port) {
+    hostValue << ":" << port.toString();
+  }
+  request->putHeaderIfNotExists_Unsafe(Header::HOST, hostValue.toString());
+  request->putHeaderIfNotExists_Unsafe(Header::CONNECTION, Header::Value::CONNECTION_KEEP_ALIVE);
+  return request;
+}
+
 void HttpRequestExecutor::invalidateConnection(const std::shared_ptr<ConnectionHandle>& connectionHandle) {
 
   if(connectionHandle) {
@@ -198,15 +347,7 @@ HttpRequestExecutor::executeOnce(const String& method,
   connection->setInputStreamIOMode(data::stream::IOMode::BLOCKING);
   connection->setOutputStreamIOMode(data::stream::IOMode::BLOCKING);
   
-  auto request = oatpp::web::protocol::http::outgoing::Request::createShared(method, path, headers, body);
-  oatpp::data::stream::BufferOutputStream hostValue;
-  hostValue << m_connectionProvider->getProperty("host").toString();
-  auto port = m_connectionProvider->getProperty("port");
-  if(port) {
-    hostValue << ":" << port.toString();
-  }
-  request->putHeaderIfNotExists_Unsafe(oatpp::web::protocol::http::Header::HOST, hostValue.toString());
-  request->putHeaderIfNotExists_Unsafe(oatpp::web::protocol::http::Header::CONNECTION, oatpp::web::protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
+  auto request = createRequest(method, path, headers, body);
 
   oatpp::data::share::MemoryLabel buffer(std::make_shared<std::string>(oatpp::data::buffer::IOBuffer::BUFFER_SIZE, 0));
 
@@ -257,8 +398,6 @@ HttpRequestExecutor::executeOnceAsync(const String& method,
   typedef protocol::http::incoming::ResponseHeadersReader ResponseHeadersReader;
   
   class ExecutorCoroutine : public oatpp::async::CoroutineWithResult<ExecutorCoroutine, const std::shared_ptr<HttpRequestExecutor::Response>&> {
-  private:
-    typedef oatpp::web::protocol::http::outgoing::Request OutgoingRequest;
   private:
     HttpRequestExecutor* m_this;
     String m_method;
@@ -306,15 +445,7 @@ HttpRequestExecutor::executeOnceAsync(const String& method,
       m_connection->setInputStreamIOMode(data::stream::IOMode::ASYNCHRONOUS);
       m_connection->setOutputStreamIOMode(data::stream::IOMode::ASYNCHRONOUS);
 
-      auto request = OutgoingRequest::createShared(m_method, m_path, m_headers, m_body);
-      oatpp::data::stream::BufferOutputStream hostValue;
-      hostValue << m_this->m_connectionProvider->getProperty("host").toString();
-      auto port = m_this->m_connectionProvider->getProperty("port");
-      if(port) {
-        hostValue << ":" << port.toString();
-      }
-      request->putHeaderIfNotExists_Unsafe(Header::HOST, hostValue.toString());
-      request->putHeaderIfNotExists_Unsafe(Header::CONNECTION, Header::Value::CONNECTION_KEEP_ALIVE);
+      auto request = m_this->createRequest(m_method, m_path, m_headers, m_body);
       m_upstream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(m_connection, m_buffer);
       return OutgoingRequest::sendAsync(request, m_upstream).next(m_upstream->flushAsync()).next(yieldTo(&ExecutorCoroutine::readResponse));
 
@@ -360,4 +491,304 @@ HttpRequestExecutor::executeOnceAsync(const String& method,
   
 }
   
+std::vector<HttpRequestExecutor::PipelinedResponse>
+HttpRequestExecutor::executePipelined(const std::vector<PipelinedRequest>& requests,
+                                      const std::shared_ptr<ConnectionHandle>& connectionHandle,
+                                      v_int32 maxInFlight,
+                                      v_buff_size maxBodySize)
+{
+
+  std::shared_ptr<ConnectionProxy> connection;
+  std::shared_ptr<HttpConnectionHandle> httpCH = std::static_pointer_cast<HttpConnectionHandle>(connectionHandle);
+  if(httpCH) {
+    connection = httpCH->getConnection();
+  }
+
+  if(!connection){
+    throw RequestExecutionError(RequestExecutionError::ERROR_CODE_CANT_CONNECT,
+                                "[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Connection is null");
+  }
+
+  std::vector<PipelinedResponse> responses(requests.size());
+  if(requests.empty()) {
+    return responses;
+  }
+
+  size_t windowSize = maxInFlight > 1 ? static_cast<size_t>(maxInFlight) : 1;
+
+  connection->setInputStreamIOMode(data::stream::IOMode::BLOCKING);
+  connection->setOutputStreamIOMode(data::stream::IOMode::BLOCKING);
+
+  /* responses are read from one persistent buffered stream - bytes of the next responses stay in its buffer */
+  oatpp::data::share::MemoryLabel outBuffer(std::make_shared<std::string>(oatpp::data::buffer::IOBuffer::BUFFER_SIZE, 0));
+  oatpp::data::share::MemoryLabel inBuffer(std::make_shared<std::string>(oatpp::data::buffer::IOBuffer::BUFFER_SIZE, 0));
+
+  auto sendStream = std::make_shared<SendErrorTracker>(connection);
+  oatpp::data::stream::OutputStreamBufferedProxy upStream(sendStream, outBuffer);
+  auto inStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(connection, inBuffer);
+
+  oatpp::web::protocol::http::incoming::ResponseHeadersReader headerReader(inBuffer, 4096);
+  auto bodyDecoder = std::make_shared<PreloadedBodyDecoder>();
+
+  size_t sent = 0;
+  size_t received = 0;
+  bool sendFailed = false;
+
+  while(received < requests.size()) {
+
+    if(!sendFailed && sent < requests.size() && sent - received < windowSize) {
+
+      while(sent < requests.size() && sent - received < windowSize) {
+        const auto& pr = requests[sent];
+        createRequest(pr.method, pr.path, pr.headers, pr.body)->send(&upStream);
+        sent ++;
+      }
+
+      /* responses to the requests sent before the failure may still be readable - stop sending only */
+      sendFailed = upStream.flush() < 0 || sendStream->hasFailed();
+
+    }
+
+    if(sendFailed && received == sent) {
+      connection->invalidate();
+      failPipelinedRequests(responses, received, RequestExecutionError::ERROR_CODE_NO_RESPONSE,
+                            "[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Error. Failed to send requests.");
+      break;
+    }
+
+    oatpp::web::protocol::http::HttpError::Info error;
+    const auto& result = headerReader.readHeaders(inStream.get(), error);
+
+    if(error.ioStatus <= 0) {
+      connection->invalidate();
+      if(sendFailed) {
+        failPipelinedRequests(responses, received, RequestExecutionError::ERROR_CODE_NO_RESPONSE,
+                              "[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Error. Failed to send requests.");
+      } else {
+        failPipelinedRequests(responses, received, RequestExecutionError::ERROR_CODE_CANT_READ_RESPONSE,
+                              "[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Error. Failed to read response.");
+      }
+      break;
+    }
+
+    if(error.status.code != 0) {
+      connection->invalidate();
+      failPipelinedRequests(responses, received, RequestExecutionError::ERROR_CODE_CANT_PARSE_STARTING_LINE,
+                            "[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Error. Failed to parse response. Invalid response headers.");
+      break;
+    }
+
+    PipelinedBodyBuffer body(maxBodySize);
+    if(responseHasBody(requests[received].method, result.startingLine.statusCode)) {
+      try {
+        m_bodyDecoder->decode(result.headers, inStream.get(), &body, connection.get());
+      } catch (std::runtime_error& e) {
+        connection->invalidate();
+        failPipelinedRequests(responses, received, RequestExecutionError::ERROR_CODE_CANT_READ_RESPONSE, e.what());
+        break;
+      }
+    }
+
+    auto bodyStream = std::make_shared<oatpp::data::stream::BufferInputStream>(body.toString());
+    responses[received].response = Response::createShared(result.startingLine.statusCode,
+                                                          result.startingLine.description.toString(),
+                                                          result.headers, bodyStream, bodyDecoder);
+    received ++;
+
+    auto connectionHeader = result.headers.getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::CONNECTION);
+    if (connectionHeader == "close") {
+      connection->setInvalidateOnDestroy(true);
+      if(received < requests.size()) {
+        failPipelinedRequests(responses, received, RequestExecutionError::ERROR_CODE_NO_RESPONSE,
+                              "[oatpp::web::client::HttpRequestExecutor::executePipelined()]: Error. Server closed connection.");
+      }
+      break;
+    }
+
+  }
+
+  if(sendFailed) {
+    connection->invalidate();
+  }
+
+  return responses;
+
+}
+
+oatpp::async::CoroutineStarterForResult<const std::vector<HttpRequestExecutor::PipelinedResponse>&>
+HttpRequestExecutor::executePipelinedAsync(const std::vector<PipelinedRequest>& requests,
+                                           const std::shared_ptr<ConnectionHandle>& connectionHandle,
+                                           v_int32 maxInFlight,
+                                           v_buff_size maxBodySize)
+{
+
+  typedef protocol::http::incoming::ResponseHeadersReader ResponseHeadersReader;
+
+  class PipelineCoroutine : public oatpp::async::CoroutineWithResult<PipelineCoroutine, const std::vector<PipelinedResponse>&> {
+  private:
+    HttpRequestExecutor* m_this;
+    std::vector<PipelinedRequest> m_requests;
+    std::shared_ptr<HttpConnectionHandle> m_connectionHandle;
+    size_t m_windowSize;
+    v_buff_size m_maxBodySize;
+    oatpp::data::share::MemoryLabel m_outBuffer;
+    oatpp::data::share::MemoryLabel m_inBuffer;
+    ResponseHeadersReader m_headersReader;
+    std::shared_ptr<const BodyDecoder> m_bodyDecoder;
+    std::shared_ptr<oatpp::data::stream::OutputStreamBufferedProxy> m_upstream;
+    std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> m_inStream;
+    ResponseHeadersReader::Result m_result;
+    std::shared_ptr<PipelinedBodyBuffer> m_body;
+    std::vector<PipelinedResponse> m_responses;
+    size_t m_sent;
+    size_t m_received;
+    bool m_sending;
+    bool m_sendFailed;
+  private:
+    std::shared_ptr<ConnectionProxy> m_connection;
+  public:
+
+    PipelineCoroutine(HttpRequestExecutor* _this,
+                      const std::vector<PipelinedRequest>& requests,
+                      const std::shared_ptr<HttpConnectionHandle>& connectionHandle,
+                      v_int32 maxInFlight,
+                      v_buff_size maxBodySize)
+      : m_this(_this)
+      , m_requests(requests)
+      , m_connectionHandle(connectionHandle)
+      , m_windowSize(maxInFlight > 1 ? static_cast<size_t>(maxInFlight) : 1)
+      , m_maxBodySize(maxBodySize)
+      , m_outBuffer(std::make_shared<std::string>(oatpp::data::buffer::IOBuffer::BUFFER_SIZE, 0))
+      , m_inBuffer(std::make_shared<std::string>(oatpp::data::buffer::IOBuffer::BUFFER_SIZE, 0))
+      , m_headersReader(m_inBuffer, 4096)
+      , m_bodyDecoder(std::make_shared<PreloadedBodyDecoder>())
+      , m_responses(requests.size())
+      , m_sent(0)
+      , m_received(0)
+      , m_sending(false)
+      , m_sendFailed(false)
+    {}
+
+    Action act() override {
+
+      if(m_connectionHandle) {
+        m_connection = m_connectionHandle->getConnection();
+      }
+
+      if(!m_connection) {
+        throw RequestExecutionError(RequestExecutionError::ERROR_CODE_CANT_CONNECT,
+                                    "[oatpp::web::client::HttpRequestExecutor::executePipelinedAsync::PipelineCoroutine{act()}]: Connection is null");
+      }
+
+      m_connection->setInputStreamIOMode(data::stream::IOMode::ASYNCHRONOUS);
+      m_connection->setOutputStreamIOMode(data::stream::IOMode::ASYNCHRONOUS);
+
+      m_upstream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(m_connection, m_outBuffer);
+      m_inStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(m_connection, m_inBuffer);
+
+      return yieldTo(&PipelineCoroutine::sendRequests);
+
+    }
+
+    Action sendRequests() {
+
+      if(m_received == m_requests.size()) {
+        if(m_sendFailed) {
+          m_connection->invalidate();
+        }
+        return _return(m_responses);
+      }
+
+      if(m_sendFailed) {
+        if(m_received < m_sent) {
+          return yieldTo(&PipelineCoroutine::readResponse);
+        }
+        m_connection->invalidate();
+        failPipelinedRequests(m_responses, m_received, RequestExecutionError::ERROR_CODE_NO_RESPONSE,
+                              "[oatpp::web::client::HttpRequestExecutor::executePipelinedAsync()]: Error. Failed to send requests.");
+        return _return(m_responses);
+      }
+
+      m_sending = true;
+
+      if(m_sent < m_requests.size() && m_sent - m_received < m_windowSize) {
+        const auto& pr = m_requests[m_sent];
+        auto request = m_this->createRequest(pr.method, pr.path, pr.headers, pr.body);
+        m_sent ++;
+        return OutgoingRequest::sendAsync(request, m_upstream).next(yieldTo(&PipelineCoroutine::sendRequests));
+      }
+
+      return m_upstream->flushAsync().next(yieldTo(&PipelineCoroutine::readResponse));
+
+    }
+
+    Action readResponse() {
+      m_sending = false;
+      return m_headersReader.readHeadersAsync(m_inStream).callbackTo(&PipelineCoroutine::onHeadersParsed);
+    }
+
+    Action onHeadersParsed(const ResponseHeadersReader::Result& result) {
+      m_result = result;
+      m_body = std::make_shared<PipelinedBodyBuffer>(m_maxBodySize);
+      if(responseHasBody(m_requests[m_received].method, m_result.startingLine.statusCode)) {
+        return m_this->m_bodyDecoder->decodeAsync(m_result.headers, m_inStream, m_body, m_connection)
+          .next(yieldTo(&PipelineCoroutine::onBodyRead));
+      }
+      return yieldTo(&PipelineCoroutine::onBodyRead);
+    }
+
+    Action onBodyRead() {
+
+      auto bodyStream = std::make_shared<oatpp::data::stream::BufferInputStream>(m_body->toString());
+      m_responses[m_received].response = Response::createShared(m_result.startingLine.statusCode,
+                                                                m_result.startingLine.description.toString(),
+                                                                m_result.headers, bodyStream, m_bodyDecoder);
+      m_received ++;
+      m_body.reset();
+
+      auto connectionHeader = m_result.headers.getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::CONNECTION);
+      if (connectionHeader == "close") {
+        m_connection->setInvalidateOnDestroy(true);
+        if(m_received < m_requests.size()) {
+          failPipelinedRequests(m_responses, m_received, RequestExecutionError::ERROR_CODE_NO_RESPONSE,
+                                "[oatpp::web::client::HttpRequestExecutor::executePipelinedAsync()]: Error. Server closed connection.");
+        }
+        return _return(m_responses);
+      }
+
+      return yieldTo(&PipelineCoroutine::sendRequests);
+
+    }
+
+    Action handleError(oatpp::async::Error* error) override {
+
+      if(!m_connection || m_received == m_requests.size()) {
+        return error;
+      }
+
+      if(m_sending) {
+        /* responses to the requests sent before the failure may still be readable - stop sending only */
+        m_sending = false;
+        m_sendFailed = true;
+        return yieldTo(&PipelineCoroutine::sendRequests);
+      }
+
+      m_connection->invalidate();
+      if(m_sendFailed) {
+        failPipelinedRequests(m_responses, m_received, RequestExecutionError::ERROR_CODE_NO_RESPONSE,
+                              "[oatpp::web::client::HttpRequestExecutor::executePipelinedAsync()]: Error. Failed to send requests.");
+      } else {
+        failPipelinedRequests(m_responses, m_received, RequestExecutionError::ERROR_CODE_CANT_READ_RESPONSE, error->what());
+      }
+      return _return(m_responses);
+
+    }
+
+  };
+
+  auto httpCH = std::static_pointer_cast<HttpConnectionHandle>(connectionHandle);
+  return PipelineCoroutine::startForResult(this, requests, httpCH, maxInFlight, maxBodySize);
+
+}
+
 }}}
@@ -28,6 +28,7 @@
 #include "./RequestExecutor.hpp"
 
 #include "oatpp/web/protocol/http/incoming/SimpleBodyDecoder.hpp"
+#include "oatpp/web/protocol/http/outgoing/Request.hpp"
 #include "oatpp/network/ConnectionPool.hpp"
 #include "oatpp/network/ConnectionProvider.hpp"
 
@@ -41,9 +42,15 @@ private:
   typedef oatpp::web::protocol::http::Header Header;
   typedef oatpp::network::ClientConnectionProvider ClientConnectionProvider;
   typedef oatpp::web::protocol::http::incoming::BodyDecoder BodyDecoder;
+  typedef oatpp::web::protocol::http::outgoing::Request OutgoingRequest;
 protected:
   std::shared_ptr<ClientConnectionProvider> m_connectionProvider;
   std::shared_ptr<const BodyDecoder> m_bodyDecoder;
+protected:
+  std::shared_ptr<OutgoingRequest> createRequest(const String& method,
+                                                 const String& path,
+                                                 const Headers& headers,
+                                                 const std::shared_ptr<Body>& body);
 public:
 
   class ConnectionProxy : public data::stream::IOStream {
@@ -73,6 +80,58 @@ public:
 
   };
 
+public:
+
+  /**
+   * Request queued for pipelined execution. See &l:HttpRequestExecutor::executePipelined ();.
+   */
+  struct PipelinedRequest {
+
+    /**
+     * Method ex: ["GET", "POST", "PUT", etc.].
+     */
+    String method;
+
+    /**
+     * Path to resource.
+     */
+    String path;
+
+    /**
+     * Headers map &id:oatpp::web::client::RequestExecutor::Headers;.
+     */
+    Headers headers;
+
+    /**
+     * `std::shared_ptr` to &id:oatpp::web::client::RequestExecutor::Body; object. May be `nullptr`.
+     */
+    std::shared_ptr<Body> body;
+
+  };
+
+  /**
+   * Outcome of one pipelined request. <br>
+   * Either `response` is set, or `errorCode` holds one of &id:oatpp::web::client::RequestExecutor::RequestExecutionError; codes.
+   */
+  struct PipelinedResponse {
+
+    /**
+     * Received response. Its body is already read from the connection and can be consumed in any order.
+     */
+    std::shared_ptr<Response> response;
+
+    /**
+     * Error code. `0` - no error.
+     */
+    v_int32 errorCode = 0;
+
+    /**
+     * Error message. `nullptr` if no error.
+     */
+    String errorMessage;
+
+  };
+
 public:
 
   /**
@@ -165,6 +224,43 @@ public:
                    const Headers& headers,
                    const std::shared_ptr<Body>& body,
                    const std::shared_ptr<ConnectionHandle>& connectionHandle = nullptr) override;
+
+  /**
+   * Execute http requests pipelined over one connection. <br>
+   * Requests are written back to back without waiting for responses, keeping at most `maxInFlight` requests unanswered.
+   * Responses are matched to requests in order. <br>
+   * If the connection fails, the request being answered gets the error, and all requests queued after it
+   * get &id:oatpp::web::client::RequestExecutor::RequestExecutionError::ERROR_CODE_NO_RESPONSE;.
+   * If sending fails, responses to the requests already sent are still read, and requests left unanswered
+   * get `ERROR_CODE_NO_RESPONSE`. The connection is invalidated in both cases. <br>
+   * If server answers with `Connection: close` the remaining requests are failed with `ERROR_CODE_NO_RESPONSE` as well. <br>
+   * Response bodies are buffered in memory. A body larger than `maxBodySize` fails its request with
+   * &id:oatpp::web::client::RequestExecutor::RequestExecutionError::ERROR_CODE_CANT_READ_RESPONSE; and invalidates the connection.
+   * @param requests - requests to execute. See &l:HttpRequestExecutor::PipelinedRequest;.
+   * @param connectionHandle - ConnectionHandle obtain in call to &l:HttpRequestExecutor::getConnection ();.
+   * @param maxInFlight - max number of requests sent but not answered yet.
+   * @param maxBodySize - max size of one response body in bytes.
+   * @return - `std::vector` of &l:HttpRequestExecutor::PipelinedResponse; - one per request, in the same order.
+   * @throws - &id:oatpp::web::client::RequestExecutor::RequestExecutionError; - if connection is null.
+   */
+  std::vector<PipelinedResponse> executePipelined(const std::vector<PipelinedRequest>& requests,
+                                                  const std::shared_ptr<ConnectionHandle>& connectionHandle,
+                                                  v_int32 maxInFlight = 8,
+                                                  v_buff_size maxBodySize = 4 * 1024 * 1024);
+
+  /**
+   * Same as &l:HttpRequestExecutor::executePipelined (); but Async.
+   * @param requests - requests to execute. See &l:HttpRequestExecutor::PipelinedRequest;.
+   * @param connectionHandle - ConnectionHandle obtain in call to &l:HttpRequestExecutor::getConnectionAsync ();.
+   * @param maxInFlight - max number of requests sent but not answered yet.
+   * @param maxBodySize - max size of one response body in bytes.
+   * @return - &id:oatpp::async::CoroutineStarterForResult;.
+   */
+  oatpp::async::CoroutineStarterForResult<const std::vector<PipelinedResponse>&>
+  executePipelinedAsync(const std::vector<PipelinedRequest>& requests,
+                        const std::shared_ptr<ConnectionHandle>& connectionHandle,
+                        v_int32 maxInFlight = 8,
+                        v_buff_size maxBodySize = 4 * 1024 * 1024);
   
 };
   
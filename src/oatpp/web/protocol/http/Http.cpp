@@ -26,6 +26,7 @@
 
 #include "oatpp/data/stream/BufferStream.hpp"
 #include "oatpp/utils/Conversion.hpp"
+#include "oatpp/utils/parser/ByteScanner.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http {
   
@@ -135,6 +136,83 @@ const char* const Header::ACCEPT_ENCODING = "Accept-Encoding";
 
 const char* const Header::EXPECT = "Expect";
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// KnownHeaders
+
+namespace {
+
+/**
+ * Open-addressing table of well-known header names built once on the first use.
+ */
+class KnownHeadersTable {
+public:
+  static constexpr v_uint64 BUCKETS_MASK = 63;
+public:
+  data::share::StringKeyLabelCI keys[KnownHeaders::SIZE];
+  v_uint64 hashes[KnownHeaders::SIZE];
+  v_int32 buckets[BUCKETS_MASK + 1];
+private:
+
+  KnownHeadersTable() {
+
+    /* same order as KnownHeaders::Id */
+    const char* const names[KnownHeaders::SIZE] = {
+      Header::ACCEPT, Header::AUTHORIZATION, Header::WWW_AUTHENTICATE, Header::CONNECTION,
+      Header::TRANSFER_ENCODING, Header::CONTENT_ENCODING, Header::CONTENT_LENGTH, Header::CONTENT_TYPE,
+      Header::CONTENT_RANGE, Header::RANGE, Header::HOST, Header::USER_AGENT,
+      Header::SERVER, Header::UPGRADE, Header::CORS_ORIGIN, Header::CORS_METHODS,
+      Header::CORS_HEADERS, Header::CORS_MAX_AGE, Header::ACCEPT_ENCODING, Header::EXPECT
+    };
+
+    std::fill(std::begin(buckets), std::end(buckets), -1);
+
+    for(v_int32 i = 0; i < KnownHeaders::SIZE; i ++) {
+      keys[i] = data::share::StringKeyLabelCI(names[i]);
+      hashes[i] = std::hash<data::share::StringKeyLabelCI>{}(keys[i]);
+      auto bucket = hashes[i] & BUCKETS_MASK;
+      while(buckets[bucket] >= 0) {
+        bucket = (bucket + 1) & BUCKETS_MASK;
+      }
+      buckets[bucket] = i;
+    }
+
+  }
+
+public:
+
+  static const KnownHeadersTable& get() {
+    static KnownHeadersTable table;
+    return table;
+  }
+
+};
+
+}
+
+v_int32 KnownHeaders::getId(const data::share::StringKeyLabelCI& key, v_uint64 hash) {
+  const auto& table = KnownHeadersTable::get();
+  auto bucket = hash & KnownHeadersTable::BUCKETS_MASK;
+  while(table.buckets[bucket] >= 0) {
+    auto id = table.buckets[bucket];
+    if(table.hashes[id] == hash && table.keys[id] == key) {
+      return id;
+    }
+    bucket = (bucket + 1) & KnownHeadersTable::BUCKETS_MASK;
+  }
+  return -1;
+}
+
+const data::share::StringKeyLabelCI& KnownHeaders::getKey(Id id) {
+  return KnownHeadersTable::get().keys[static_cast<v_int32>(id)];
+}
+
+v_uint64 KnownHeaders::getHash(Id id) {
+  return KnownHeadersTable::get().hashes[static_cast<v_int32>(id)];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Range
+
 const char* const Range::UNIT_BYTES = "bytes";
 const char* const ContentRange::UNIT_BYTES = "bytes";
   
@@ -142,9 +220,13 @@ oatpp::String Range::toString() const {
   data::stream::BufferOutputStream stream(256);
   stream.writeSimple(units->data(), static_cast<v_buff_size>(units->size()));
   stream.writeSimple("=", 1);
-  stream.writeAsString(start);
+  if(start >= 0) {
+    stream.writeAsString(start);
+  }
   stream.writeSimple("-", 1);
-  stream.writeAsString(end);
+  if(end >= 0) {
+    stream.writeAsString(end);
+  }
   return stream.toString();
 }
 
@@ -172,8 +254,15 @@ Range Range::parse(oatpp::utils::parser::Caret& caret) {
   caret.findRN();
   endLabel.end();
 
-  auto start = oatpp::utils::Conversion::strToInt64(startLabel.getData());
-  auto end = oatpp::utils::Conversion::strToInt64(endLabel.getData());
+  /* "bytes=500-" - open-ended range, "bytes=-500" - suffix range */
+  v_int64 start = -1;
+  v_int64 end = -1;
+  if(startLabel.getSize() > 0) {
+    start = oatpp::utils::Conversion::strToInt64(startLabel.getData());
+  }
+  if(endLabel.getSize() > 0) {
+    end = oatpp::utils::Conversion::strToInt64(endLabel.getData());
+  }
   return Range(unitsLabel.toString(), start, end);
   
 }
@@ -362,21 +451,69 @@ void Parser::parseOneHeader(Headers& headers,
   }
 }
 
+namespace {
+
+/* optional whitespace - SP / HTAB (RFC 9110, 5.6.3) */
+v_buff_size skipOWS(const char* data, v_buff_size size, v_buff_size pos) {
+  while(pos < size && (data[pos] == ' ' || data[pos] == '\t')) {
+    pos ++;
+  }
+  return pos;
+}
+
+}
+
 void Parser::parseHeaders(Headers& headers,
                           const std::shared_ptr<std::string>& headersText,
                           oatpp::utils::parser::Caret& caret,
                           Status& error)
 {
-  
-  while (!caret.isAtRN()) {
-    parseOneHeader(headers, headersText, caret, error);
-    if(error.code != 0) {
+
+  typedef oatpp::utils::parser::ByteScanner ByteScanner;
+
+  /* Single pass over the headers block - vectorized search of ':' and line ends */
+
+  const char* data = caret.getData();
+  const v_buff_size size = caret.getDataSize();
+  v_buff_size pos = caret.getPosition();
+
+  while (!(pos + 1 < size && data[pos] == '\r' && data[pos + 1] == '\n')) {
+
+    pos = skipOWS(data, size, pos);
+
+    auto nameSize = ByteScanner::findCharFromPair(data + pos, size - pos, ':', ' ');
+    if(nameSize < 0) {
+      caret.setPosition(pos);
+      error = Status::CODE_431;
       return;
     }
+
+    oatpp::data::share::StringKeyLabelCI name(headersText, data + pos, nameSize);
+    pos += nameSize;
+
+    pos = skipOWS(data, size, pos);
+    if(pos >= size || data[pos] != ':') {
+      caret.setPosition(pos);
+      error = Status::CODE_400;
+      return;
+    }
+    pos ++;
+    pos = skipOWS(data, size, pos);
+
+    auto valueSize = ByteScanner::findRN(data + pos, size - pos);
+    if(valueSize < 0) {
+      caret.setPosition(size);
+      error = Status::CODE_431;
+      return;
+    }
+
+    headers.put_LockFree(name, oatpp::data::share::StringKeyLabel(headersText, data + pos, valueSize));
+    pos += valueSize + 2;
+
   }
-  
-  caret.skipRN();
-  
+
+  caret.setPosition(pos + 2);
+
 }
 
 void Parser::parseHeaderValueData(HeaderValueData& data, const oatpp::data::share::StringKeyLabel& headerValue, char separator) {
@@ -30,6 +30,7 @@
 #include "oatpp/web/protocol/CommunicationError.hpp"
 
 #include "oatpp/utils/parser/Caret.hpp"
+#include "oatpp/data/share/LazyStringFlatMap.hpp"
 #include "oatpp/data/share/LazyStringMap.hpp"
 #include "oatpp/Types.hpp"
 
@@ -38,11 +39,75 @@
 
 namespace oatpp { namespace web { namespace protocol { namespace http {
 
+/**
+ * Registry of well-known header names. <br>
+ * Well-known names are interned to integer ids when put to &l:Headers;, so their lookups are array indexing.
+ * See &id:oatpp::data::share::NoKeyRegistry; for the interface.
+ */
+class KnownHeaders {
+public:
+
+  /**
+   * Ids of well-known headers. Same names as in &l:Header;.
+   */
+  enum class Id : v_int32 {
+    ACCEPT = 0,
+    AUTHORIZATION,
+    WWW_AUTHENTICATE,
+    CONNECTION,
+    TRANSFER_ENCODING,
+    CONTENT_ENCODING,
+    CONTENT_LENGTH,
+    CONTENT_TYPE,
+    CONTENT_RANGE,
+    RANGE,
+    HOST,
+    USER_AGENT,
+    SERVER,
+    UPGRADE,
+    CORS_ORIGIN,
+    CORS_METHODS,
+    CORS_HEADERS,
+    CORS_MAX_AGE,
+    ACCEPT_ENCODING,
+    EXPECT
+  };
+
+  /**
+   * Number of well-known headers.
+   */
+  static constexpr v_int32 SIZE = 20;
+
+  /**
+   * Get id of the header name.
+   * @param key - header name.
+   * @param hash - case-insensitive hash of the header name.
+   * @return - id of the header or `-1` if header is not well-known.
+   */
+  static v_int32 getId(const data::share::StringKeyLabelCI& key, v_uint64 hash);
+
+  /**
+   * Get header name by id.
+   * @param id
+   * @return
+   */
+  static const data::share::StringKeyLabelCI& getKey(Id id);
+
+  /**
+   * Get case-insensitive hash of the header name.
+   * @param id
+   * @return
+   */
+  static v_uint64 getHash(Id id);
+
+};
+
 /**
  * Typedef for headers map. Headers map key is case-insensitive.
- * For more info see &id:oatpp::data::share::LazyStringMultimap;.
+ * Headers belong to a single request/response and are not synchronized.
+ * For more info see &id:oatpp::data::share::LazyStringFlatMultimap; and &l:KnownHeaders;.
  */
-typedef oatpp::data::share::LazyStringMultimap<oatpp::data::share::StringKeyLabelCI> Headers;
+typedef oatpp::data::share::LazyStringFlatMultimap<oatpp::data::share::StringKeyLabelCI, oatpp::data::share::StringKeyLabel, 16, KnownHeaders> Headers;
 
 /**
  * Typedef for query parameters map.
@@ -471,6 +536,12 @@ if(!(COND)) { throw oatpp::web::protocol::http::HttpError(STATUS, MESSAGE); }
 class Header {
 public:
 
+  /**
+   * Ids of well-known headers - &l:KnownHeaders::Id;. <br>
+   * Use ids instead of names for the fastest lookup - `headers.get(Header::Id::CONTENT_LENGTH)`.
+   */
+  typedef KnownHeaders::Id Id;
+
   /**
    * Possible values for headers.
    */
@@ -511,6 +582,12 @@ public:
   static const char* const EXPECT;              // Expect
 };
   
+/**
+ * Value of the `Range` header. <br>
+ * `end` is `-1` for open-ended range (`bytes=500-`). <br>
+ * `start` is `-1` for suffix range (`bytes=-500`) - `end` is then the length of the suffix. <br>
+ * *Note: &l:Range::parse (); used to return `0` for an omitted bound. Code checking for `0` has to check for `-1` now.*
+ */
 class Range {
 public:
   static const char* const UNIT_BYTES;
@@ -60,6 +60,10 @@ void Request::setPathVariables(const url::mapping::Pattern::MatchMap& pathVariab
   m_pathVariables = pathVariables;
 }
 
+void Request::setPathVariables(url::mapping::Pattern::MatchMap&& pathVariables) {
+  m_pathVariables = std::move(pathVariables);
+}
+
 const url::mapping::Pattern::MatchMap& Request::getPathVariables() const {
   return m_pathVariables;
 }
@@ -122,6 +126,10 @@ oatpp::String Request::getHeader(const oatpp::data::share::StringKeyLabelCI& hea
   return m_headers.get(headerName);
 }
 
+oatpp::String Request::getHeader(http::Header::Id headerId) const {
+  return m_headers.get(headerId);
+}
+
 oatpp::String Request::getPathVariable(const oatpp::data::share::StringKeyLabel& name) const {
   return m_pathVariables.getVariable(name);
 }
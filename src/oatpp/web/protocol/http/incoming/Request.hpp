@@ -112,6 +112,12 @@ public:
    */
   void setPathVariables(const url::mapping::Pattern::MatchMap& pathVariables);
 
+  /**
+   * Set request path variables.
+   * @param pathVariables - &id:oatpp::web::url::mapping::Pattern::MatchMap;.
+   */
+  void setPathVariables(url::mapping::Pattern::MatchMap&& pathVariables);
+
   /**
    * Get path variables according to path-pattern. <br>
    * Ex. given request path="/sum/19/1" for path-pattern="/sum/{a}/{b}" <br>
@@ -192,6 +198,13 @@ public:
    */
   oatpp::String getHeader(const oatpp::data::share::StringKeyLabelCI& headerName) const;
 
+  /**
+   * Get value of the well-known header. Faster than lookup by name.
+   * @param headerId - &id:oatpp::web::protocol::http::Header::Id;.
+   * @return - &id:oatpp::String;.
+   */
+  oatpp::String getHeader(http::Header::Id headerId) const;
+
   /**
    * Get path variable according to path-pattern
    * @param name
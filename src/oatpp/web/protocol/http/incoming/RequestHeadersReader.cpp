@@ -24,6 +24,8 @@
 
 #include "RequestHeadersReader.hpp"
 
+#include "oatpp/utils/parser/ByteScanner.hpp"
+
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
 v_io_size RequestHeadersReader::readHeadersSectionIterative(ReadHeadersIteration& iteration,
@@ -40,20 +42,22 @@ v_io_size RequestHeadersReader::readHeadersSectionIterative(ReadHeadersIteration
   }
 
   m_bufferStream->reserveBytesUpfront(desiredToRead);
-  auto bufferData = m_bufferStream->getData() + m_bufferStream->getCurrentPosition();
+  auto chunkPosition = m_bufferStream->getCurrentPosition();
+  auto bufferData = m_bufferStream->getData() + chunkPosition;
   auto res = stream->peek(bufferData, desiredToRead, action);
   if(res > 0) {
 
-    m_bufferStream->setCurrentPosition(m_bufferStream->getCurrentPosition() + res);
+    m_bufferStream->setCurrentPosition(chunkPosition + res);
 
-    for(v_buff_size i = 0; i < res; i ++) {
-      iteration.accumulator <<= 8;
-      iteration.accumulator |= bufferData[i];
-      if(iteration.accumulator == SECTION_END) {
-        stream->commitReadOffset(i + 1);
-        iteration.done = true;
-        return res;
-      }
+    /* section end may start in the previous chunk */
+    v_buff_size scanPosition = chunkPosition > 3 ? chunkPosition - 3 : 0;
+    auto data = reinterpret_cast<const char*>(m_bufferStream->getData());
+    auto index = oatpp::utils::parser::ByteScanner::findRNRN(data + scanPosition, chunkPosition + res - scanPosition);
+
+    if(index >= 0) {
+      stream->commitReadOffset(scanPosition + index + 4 - chunkPosition);
+      iteration.done = true;
+      return res;
     }
 
     stream->commitReadOffset(res);
@@ -67,27 +71,37 @@ v_io_size RequestHeadersReader::readHeadersSectionIterative(ReadHeadersIteration
 RequestHeadersReader::Result RequestHeadersReader::readHeaders(data::stream::InputStreamBufferedProxy* stream,
                                                                http::HttpError::Info& error) {
 
-  m_bufferStream->setCurrentPosition(0);
-
   RequestHeadersReader::Result result;
-  ReadHeadersIteration iteration;
-  async::Action action;
 
-  while(!iteration.done) {
+  if(m_sectionBuffered) {
 
-    error.ioStatus = readHeadersSectionIterative(iteration, stream, action);
+    m_sectionBuffered = false;
+    error.ioStatus = m_bufferStream->getCurrentPosition();
 
-    if(!action.isNone()) {
-      OATPP_LOGE("[oatpp::web::protocol::http::incoming::RequestHeadersReader::readHeaders]", "Error. Async action is unexpected.")
-      throw std::runtime_error("[oatpp::web::protocol::http::incoming::RequestHeadersReader::readHeaders]: Error. Async action is unexpected.");
-    }
+  } else {
+
+    m_bufferStream->setCurrentPosition(0);
+
+    ReadHeadersIteration iteration;
+    async::Action action;
+
+    while(!iteration.done) {
+
+      error.ioStatus = readHeadersSectionIterative(iteration, stream, action);
+
+      if(!action.isNone()) {
+        OATPP_LOGE("[oatpp::web::protocol::http::incoming::RequestHeadersReader::readHeaders]", "Error. Async action is unexpected.")
+        throw std::runtime_error("[oatpp::web::protocol::http::incoming::RequestHeadersReader::readHeaders]: Error. Async action is unexpected.");
+      }
+
+      if(error.ioStatus > 0) {
+        continue;
+      } else if(error.ioStatus == IOError::RETRY_READ || error.ioStatus == IOError::RETRY_WRITE) {
+        continue;
+      } else {
+        break;
+      }
 
-    if(error.ioStatus > 0) {
-      continue;
-    } else if(error.ioStatus == IOError::RETRY_READ || error.ioStatus == IOError::RETRY_WRITE) {
-      continue;
-    } else {
-      break;
     }
 
   }
@@ -175,4 +189,54 @@ RequestHeadersReader::readHeadersAsync(const std::shared_ptr<data::stream::Input
   
 }
 
+oatpp::async::CoroutineStarter RequestHeadersReader::bufferHeadersAsync(const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream) {
+
+  class BufferCoroutine : public oatpp::async::Coroutine<BufferCoroutine> {
+  private:
+    std::shared_ptr<data::stream::InputStreamBufferedProxy> m_stream;
+    RequestHeadersReader* m_this;
+    ReadHeadersIteration m_iteration;
+  public:
+
+    BufferCoroutine(RequestHeadersReader* _this,
+                    const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream)
+      : m_stream(stream)
+      , m_this(_this)
+    {
+      m_this->m_bufferStream->setCurrentPosition(0);
+      m_this->m_sectionBuffered = false;
+    }
+
+    Action act() override {
+
+      async::Action action;
+      auto res = m_this->readHeadersSectionIterative(m_iteration, m_stream.get(), action);
+
+      if(!action.isNone()) {
+        return action;
+      }
+
+      if(m_iteration.done) {
+        m_this->m_sectionBuffered = true;
+        return finish();
+      } else {
+
+        if (res > 0) {
+          return repeat();
+        } else if (res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+          return repeat();
+        }
+
+      }
+
+      return error<Error>("[oatpp::web::protocol::http::incoming::RequestHeadersReader::bufferHeadersAsync()]: Error. Error reading connection stream.");
+
+    }
+
+  };
+
+  return BufferCoroutine::start(this, stream);
+
+}
+
 }}}}}
@@ -41,8 +41,6 @@ public:
    * Convenience typedef for &id:oatpp::async::Action;.
    */
   typedef oatpp::async::Action Action;
-private:
-  static constexpr v_uint32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
 public:
 
   /**
@@ -64,7 +62,6 @@ public:
 private:
 
   struct ReadHeadersIteration {
-    v_uint32 accumulator = 0;
     bool done = false;
   };
 
@@ -76,6 +73,7 @@ private:
   oatpp::data::stream::BufferOutputStream* m_bufferStream;
   v_buff_size m_readChunkSize;
   v_buff_size m_maxHeadersSize;
+  bool m_sectionBuffered;
 public:
 
   /**
@@ -89,6 +87,7 @@ public:
     : m_bufferStream(bufferStream)
     , m_readChunkSize(readChunkSize)
     , m_maxHeadersSize(maxHeadersSize)
+    , m_sectionBuffered(false)
   {}
 
   /**
@@ -99,6 +98,15 @@ public:
    */
   Result readHeaders(data::stream::InputStreamBufferedProxy* stream, http::HttpError::Info& error);
 
+  /**
+   * Read http headers section from stream into the buffer in asynchronous manner, without parsing it. <br>
+   * The next call to &l:RequestHeadersReader::readHeaders (); parses the buffered section instead of reading the stream.
+   * Use it to wait for the complete headers without blocking a thread.
+   * @param stream - `std::shared_ptr` to &id:oatpp::data::stream::InputStreamBufferedProxy;.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  oatpp::async::CoroutineStarter bufferHeadersAsync(const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream);
+
   /**
    * Read and parse http headers from stream in asynchronous manner.
    * @param stream - `std::shared_ptr` to &id:oatpp::data::stream::InputStreamBufferedProxy;.
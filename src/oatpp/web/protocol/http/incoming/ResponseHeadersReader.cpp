@@ -24,7 +24,7 @@
 
 #include "ResponseHeadersReader.hpp"
 
-#include "oatpp/data/stream/BufferStream.hpp"
+#include "oatpp/utils/parser/ByteScanner.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
@@ -66,6 +66,55 @@ v_io_size ResponseHeadersReader::readHeadersSectionIterative(ReadHeadersIteratio
 
 }
 
+v_io_size ResponseHeadersReader::readHeadersSectionIterative(ReadHeadersIteration& iteration,
+                                                             data::stream::InputStreamBufferedProxy* stream,
+                                                             data::stream::BufferOutputStream* bufferStream,
+                                                             async::Action& action)
+{
+
+  v_buff_size desiredToRead = m_buffer.getSize();
+  if(bufferStream->getCurrentPosition() + desiredToRead > m_maxHeadersSize) {
+    desiredToRead = m_maxHeadersSize - bufferStream->getCurrentPosition();
+    if(desiredToRead <= 0) {
+      return -1;
+    }
+  }
+
+  bufferStream->reserveBytesUpfront(desiredToRead);
+  auto chunkPosition = bufferStream->getCurrentPosition();
+  auto res = stream->peek(bufferStream->getData() + chunkPosition, desiredToRead, action);
+  if(res > 0) {
+
+    /* section end may start in the previous chunk */
+    v_buff_size scanPosition = chunkPosition > 3 ? chunkPosition - 3 : 0;
+    auto data = reinterpret_cast<const char*>(bufferStream->getData());
+    auto index = oatpp::utils::parser::ByteScanner::findRNRN(data + scanPosition, chunkPosition + res - scanPosition);
+
+    if(index >= 0) {
+      auto sectionEnd = scanPosition + index + 4;
+      stream->commitReadOffset(sectionEnd - chunkPosition);
+      bufferStream->setCurrentPosition(sectionEnd);
+      iteration.done = true;
+      return res;
+    }
+
+    bufferStream->setCurrentPosition(chunkPosition + res);
+    stream->commitReadOffset(res);
+
+  }
+
+  return res;
+
+}
+
+void ResponseHeadersReader::parseHeadersSection(const oatpp::String& headersText, Result& result, http::Status& status) {
+  oatpp::utils::parser::Caret caret (headersText);
+  http::Parser::parseResponseStartingLine(result.startingLine, headersText.getPtr(), caret, status);
+  if(status.code == 0) {
+    http::Parser::parseHeaders(result.headers, headersText.getPtr(), caret, status);
+  }
+}
+
 ResponseHeadersReader::Result ResponseHeadersReader::readHeaders(const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
                                                                  http::HttpError::Info& error) {
   
@@ -176,4 +225,106 @@ ResponseHeadersReader::readHeadersAsync(const std::shared_ptr<oatpp::data::strea
   
 }
   
+ResponseHeadersReader::Result ResponseHeadersReader::readHeaders(data::stream::InputStreamBufferedProxy* stream,
+                                                                 http::HttpError::Info& error) {
+
+  Result result;
+  result.bufferPosStart = 0;
+  result.bufferPosEnd = 0;
+  ReadHeadersIteration iteration;
+  async::Action action;
+
+  oatpp::data::stream::BufferOutputStream buffer;
+
+  while(!iteration.done) {
+
+    error.ioStatus = readHeadersSectionIterative(iteration, stream, &buffer, action);
+
+    if(!action.isNone()) {
+      OATPP_LOGE("[oatpp::web::protocol::http::incoming::ResponseHeadersReader::readHeaders]", "Error. Async action is unexpected.")
+      throw std::runtime_error("[oatpp::web::protocol::http::incoming::ResponseHeadersReader::readHeaders]: Error. Async action is unexpected.");
+    }
+
+    if(error.ioStatus > 0) {
+      continue;
+    } else if(error.ioStatus == IOError::RETRY_READ || error.ioStatus == IOError::RETRY_WRITE) {
+      continue;
+    } else {
+      break;
+    }
+
+  }
+
+  if(error.ioStatus > 0) {
+    parseHeadersSection(buffer.toString(), result, error.status);
+  }
+
+  return result;
+
+}
+
+oatpp::async::CoroutineStarterForResult<const ResponseHeadersReader::Result&>
+ResponseHeadersReader::readHeadersAsync(const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream)
+{
+
+  class ReaderCoroutine : public oatpp::async::CoroutineWithResult<ReaderCoroutine, const Result&> {
+  private:
+    ResponseHeadersReader* m_this;
+    std::shared_ptr<data::stream::InputStreamBufferedProxy> m_stream;
+    ReadHeadersIteration m_iteration;
+    ResponseHeadersReader::Result m_result;
+    oatpp::data::stream::BufferOutputStream m_bufferStream;
+  public:
+
+    ReaderCoroutine(ResponseHeadersReader* _this,
+                    const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream)
+      : m_this(_this)
+      , m_stream(stream)
+    {
+      m_result.bufferPosStart = 0;
+      m_result.bufferPosEnd = 0;
+    }
+
+    Action act() override {
+
+      async::Action action;
+      auto res = m_this->readHeadersSectionIterative(m_iteration, m_stream.get(), &m_bufferStream, action);
+
+      if(!action.isNone()) {
+        return action;
+      }
+
+      if(m_iteration.done) {
+        return yieldTo(&ReaderCoroutine::parseHeaders);
+      } else {
+
+        if (res > 0) {
+          return repeat();
+        } else if (res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+          return repeat();
+        }
+
+      }
+
+      return error<Error>("[oatpp::web::protocol::http::incoming::ResponseHeadersReader::readHeadersAsync()]: Error. Error reading connection stream.");
+
+    }
+
+    Action parseHeaders() {
+
+      http::Status status;
+      parseHeadersSection(m_bufferStream.toString(), m_result, status);
+      if(status.code == 0) {
+        return _return(m_result);
+      }
+      return error<Error>("[oatpp::web::protocol::http::incoming::ResponseHeadersReader::readHeadersAsync()]: Error. Can't parse response headers.");
+
+    }
+
+  };
+
+  return ReaderCoroutine::startForResult(this, stream);
+
+}
+
 }}}}}
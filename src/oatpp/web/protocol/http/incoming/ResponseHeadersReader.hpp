@@ -26,6 +26,8 @@
 #define oatpp_web_protocol_http_incoming_ResponseHeadersReader_hpp
 
 #include "oatpp/web/protocol/http/Http.hpp"
+#include "oatpp/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
 #include "oatpp/async/Coroutine.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
@@ -83,6 +85,13 @@ private:
                                               Result& result,
                                               async::Action& action);
 
+  v_io_size readHeadersSectionIterative(ReadHeadersIteration& iteration,
+                                        data::stream::InputStreamBufferedProxy* stream,
+                                        data::stream::BufferOutputStream* bufferStream,
+                                        async::Action& action);
+
+  static void parseHeadersSection(const oatpp::String& headersText, Result& result, http::Status& status);
+
 private:
   oatpp::data::share::MemoryLabel m_buffer;
   v_buff_size m_maxHeadersSize;
@@ -112,6 +121,23 @@ public:
    * @return - &id:oatpp::async::CoroutineStarterForResult;.
    */
   oatpp::async::CoroutineStarterForResult<const Result&> readHeadersAsync(const std::shared_ptr<oatpp::data::stream::IOStream>& connection);
+
+  /**
+   * Read and parse http headers from buffered stream. <br>
+   * Only the headers section is consumed from the stream - the data following it (response body and pipelined responses)
+   * stays in the stream. `bufferPosStart` and `bufferPosEnd` of the result are always `0`.
+   * @param stream - &id:oatpp::data::stream::InputStreamBufferedProxy;.
+   * @param error - out parameter &id:oatpp::web::protocol::ProtocolError::Info;.
+   * @return - &l:ResponseHeadersReader::Result;.
+   */
+  Result readHeaders(data::stream::InputStreamBufferedProxy* stream, http::HttpError::Info& error);
+
+  /**
+   * Same as &l:ResponseHeadersReader::readHeaders (); for buffered stream but Async.
+   * @param stream - `std::shared_ptr` to &id:oatpp::data::stream::InputStreamBufferedProxy;.
+   * @return - &id:oatpp::async::CoroutineStarterForResult;.
+   */
+  oatpp::async::CoroutineStarterForResult<const Result&> readHeadersAsync(const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream);
   
 };
   
@@ -81,7 +81,7 @@ SimpleBodyDecoder::getStreamProcessor (const data::share::StringKeyLabelCI& tran
 
 void SimpleBodyDecoder::handleExpectHeader(const Headers& headers, data::stream::IOStream* connection) const {
 
-  auto expect = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::EXPECT);
+  auto expect = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::EXPECT);
   if(expect == Header::Value::EXPECT_100_CONTINUE) {
     auto res = connection->writeExactSizeDataSimple(RESPONSE_100_CONTINUE.data(), static_cast<v_buff_size>(RESPONSE_100_CONTINUE.size()));
     if(res != static_cast<v_io_size>(RESPONSE_100_CONTINUE.size())) {
@@ -95,7 +95,7 @@ void SimpleBodyDecoder::handleExpectHeader(const Headers& headers, data::stream:
 oatpp::async::CoroutineStarter SimpleBodyDecoder::handleExpectHeaderAsync(const Headers& headers,
                                                                           const std::shared_ptr<data::stream::IOStream>& connection) const
 {
-  auto expect = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::EXPECT);
+  auto expect = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::EXPECT);
   if(expect == Header::Value::EXPECT_100_CONTINUE) {
     return connection->writeExactSizeDataAsync(RESPONSE_100_CONTINUE.data(), static_cast<v_buff_size>(RESPONSE_100_CONTINUE.size()));
   }
@@ -109,11 +109,11 @@ void SimpleBodyDecoder::decode(const Headers& headers,
 {
 
   handleExpectHeader(headers, connection);
-  auto transferEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::TRANSFER_ENCODING);
+  auto transferEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::TRANSFER_ENCODING);
 
   if(transferEncoding) {
 
-    auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
+    auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONTENT_ENCODING);
     auto processor = getStreamProcessor(transferEncoding, contentEncoding);
 
     data::buffer::IOBuffer buffer;
@@ -121,7 +121,7 @@ void SimpleBodyDecoder::decode(const Headers& headers,
 
   } else {
 
-    auto contentLengthStr = headers.getAsMemoryLabel<data::share::StringKeyLabel>(Header::CONTENT_LENGTH);
+    auto contentLengthStr = headers.getAsMemoryLabel<data::share::StringKeyLabel>(Header::Id::CONTENT_LENGTH);
     if(contentLengthStr) {
 
       bool success;
@@ -129,7 +129,7 @@ void SimpleBodyDecoder::decode(const Headers& headers,
 
       if (success && contentLength > 0) {
 
-        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
+        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
         data::buffer::IOBuffer buffer;
         data::stream::transfer(bodyStream, writeCallback, contentLength, buffer.getData(), buffer.getSize(), processor);
@@ -138,11 +138,11 @@ void SimpleBodyDecoder::decode(const Headers& headers,
 
     } else {
 
-      auto connectionStr = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONNECTION);
+      auto connectionStr = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONNECTION);
 
       if(connectionStr && connectionStr == "close") {
 
-        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
+        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
         data::buffer::IOBuffer buffer;
         data::stream::transfer(bodyStream, writeCallback,  0 /* read until error */, buffer.getData(), buffer.getSize(), processor);
@@ -164,18 +164,18 @@ async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
 {
 
   auto pipeline = handleExpectHeaderAsync(headers, connection);
-  auto transferEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::TRANSFER_ENCODING);
+  auto transferEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::TRANSFER_ENCODING);
 
   if(transferEncoding) {
 
-    auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
+    auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONTENT_ENCODING);
     auto processor = getStreamProcessor(transferEncoding, contentEncoding);
     auto buffer = data::buffer::IOBuffer::createShared();
     return std::move(pipeline.next(data::stream::transferAsync(bodyStream, writeCallback, 0 /* read until error */, buffer, processor)));
 
   } else {
 
-    auto contentLengthStr = headers.getAsMemoryLabel<data::share::StringKeyLabel>(Header::CONTENT_LENGTH);
+    auto contentLengthStr = headers.getAsMemoryLabel<data::share::StringKeyLabel>(Header::Id::CONTENT_LENGTH);
     if(contentLengthStr) {
 
       bool success;
@@ -183,7 +183,7 @@ async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
 
       if (success && contentLength > 0) {
 
-        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
+        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
         auto buffer = data::buffer::IOBuffer::createShared();
         return std::move(pipeline.next(data::stream::transferAsync(bodyStream, writeCallback, contentLength, buffer, processor)));
@@ -192,11 +192,11 @@ async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
 
     } else {
 
-      auto connectionStr = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONNECTION);
+      auto connectionStr = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONNECTION);
 
       if(connectionStr && connectionStr == "close") {
 
-        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
+        auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::Id::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
         auto buffer = data::buffer::IOBuffer::createShared();
         return std::move(pipeline.next(data::stream::transferAsync(bodyStream, writeCallback,  0 /* read until error */, buffer, processor)));
@@ -0,0 +1,257 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "FileBody.hpp"
+
+#include "oatpp/network/tcp/Connection.hpp"
+#include "oatpp/utils/Conversion.hpp"
+
+#include <cstdio>
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+oatpp::String getFileLocation(data::resource::File& file) {
+  auto location = file.getLocation();
+  if(!location) {
+    OATPP_LOGE("[oatpp::web::protocol::http::outgoing::FileBody::FileBody()]", "Error. File is NOT initialized.")
+    throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::FileBody()]: Error. File is NOT initialized.");
+  }
+  return location;
+}
+
+}
+
+FileBody::FileBody(const data::resource::File& file, const data::share::StringKeyLabel& contentType)
+  : m_file(file)
+  , m_stream(getFileLocation(m_file)->c_str())
+  , m_contentType(contentType)
+  , m_fileSize(0)
+  , m_rangeStart(0)
+  , m_rangeEnd(-1)
+  , m_isRange(false)
+  , m_position(0)
+{
+  std::fseek(m_stream.getFile(), 0, SEEK_END);
+  m_fileSize = std::ftell(m_stream.getFile());
+  m_rangeEnd = m_fileSize - 1;
+  seekToRangeStart();
+}
+
+FileBody::FileBody(const data::resource::File& file, const Range& range, const data::share::StringKeyLabel& contentType)
+  : FileBody(file, contentType)
+{
+
+  v_int64 start = range.start;
+  v_int64 end = range.end;
+
+  if(range.start < 0) {
+    /* suffix range - last 'end' bytes of the file */
+    start = end > 0 ? m_fileSize - end : m_fileSize;
+    if(start < 0) {
+      start = 0;
+    }
+    end = m_fileSize - 1;
+  } else if(end < 0 || end >= m_fileSize) {
+    end = m_fileSize - 1;
+  }
+
+  if(!range.isValid() || range.units != Range::UNIT_BYTES || start >= m_fileSize || start > end) {
+    Headers headers;
+    headers.put(Header::CONTENT_RANGE, oatpp::String("bytes */") + utils::Conversion::int64ToStr(m_fileSize));
+    throw HttpError(Status::CODE_416, "Requested range not satisfiable", headers);
+  }
+
+  m_rangeStart = start;
+  m_rangeEnd = end;
+  m_isRange = true;
+  seekToRangeStart();
+
+}
+
+void FileBody::seekToRangeStart() {
+  std::fseek(m_stream.getFile(), toFileOffset<long>(m_rangeStart), SEEK_SET);
+}
+
+std::shared_ptr<FileBody> FileBody::createShared(const data::resource::File& file,
+                                                 const data::share::StringKeyLabel& contentType) {
+  return std::make_shared<FileBody>(file, contentType);
+}
+
+std::shared_ptr<FileBody> FileBody::createShared(const data::resource::File& file,
+                                                 const Range& range,
+                                                 const data::share::StringKeyLabel& contentType) {
+  return std::make_shared<FileBody>(file, range, contentType);
+}
+
+v_io_size FileBody::read(void *buffer, v_buff_size count, async::Action& action) {
+
+  auto bytesLeft = getKnownSize() - m_position;
+  if(bytesLeft <= 0) {
+    return 0;
+  }
+
+  if(count > bytesLeft) {
+    count = bytesLeft;
+  }
+
+  auto res = m_stream.read(buffer, count, action);
+  if(res > 0) {
+    m_position += res;
+  }
+  return res;
+
+}
+
+void FileBody::declareHeaders(Headers& headers) {
+  if (m_contentType) {
+    headers.putIfNotExists(Header::CONTENT_TYPE, m_contentType);
+  }
+  if(m_isRange) {
+    ContentRange contentRange(ContentRange::UNIT_BYTES, m_rangeStart, m_rangeEnd, m_fileSize, true);
+    headers.putOrReplace(Header::CONTENT_RANGE, contentRange.toString());
+  }
+}
+
+p_char8 FileBody::getKnownData() {
+  return nullptr;
+}
+
+v_int64 FileBody::getKnownSize() {
+  return m_rangeEnd - m_rangeStart + 1;
+}
+
+v_int64 FileBody::getFileSize() const {
+  return m_fileSize;
+}
+
+bool FileBody::isZeroCopySupported(data::stream::OutputStream* stream) {
+#ifdef OATPP_NETWORK_TCP_SENDFILE
+  return dynamic_cast<network::tcp::Connection*>(stream) != nullptr;
+#else
+  (void) stream;
+  return false;
+#endif
+}
+
+v_io_size FileBody::sendFile(data::stream::OutputStream* stream, async::Action& action) {
+
+#ifdef OATPP_NETWORK_TCP_SENDFILE
+
+  auto bytesLeft = getKnownSize() - m_position;
+  if(bytesLeft <= 0) {
+    return 0;
+  }
+
+  auto connection = dynamic_cast<network::tcp::Connection*>(stream);
+  if(connection == nullptr) {
+    OATPP_LOGE("[oatpp::web::protocol::http::outgoing::FileBody::sendFile()]", "Error. Zero-copy is not supported by the stream.")
+    return IOError::BROKEN_PIPE;
+  }
+
+  auto res = connection->sendFile(fileno(m_stream.getFile()), m_rangeStart + m_position, bytesLeft, action);
+  if(res > 0) {
+    m_position += res;
+  }
+  return res;
+
+#else
+
+  (void) stream;
+  (void) action;
+  OATPP_LOGE("[oatpp::web::protocol::http::outgoing::FileBody::sendFile()]", "Error. Zero-copy is not supported on this platform.")
+  return IOError::BROKEN_PIPE;
+
+#endif
+
+}
+
+v_io_size FileBody::sendFileSimple(data::stream::OutputStream* stream) {
+  v_io_size result = 0;
+  while(true) {
+    async::Action action;
+    auto res = sendFile(stream, action);
+    if(!action.isNone()) {
+      OATPP_LOGE("[oatpp::web::protocol::http::outgoing::FileBody::sendFileSimple()]", "Error. sendFileSimple() is called on a stream in Async mode.")
+      throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::sendFileSimple()]: Error. sendFileSimple() is called on a stream in Async mode.");
+    }
+    if(res > 0) {
+      result += res;
+    } else if(res != IOError::RETRY_READ && res != IOError::RETRY_WRITE) {
+      break;
+    }
+  }
+  return result;
+}
+
+async::CoroutineStarter FileBody::sendFileAsync(const std::shared_ptr<FileBody>& body,
+                                                const std::shared_ptr<data::stream::OutputStream>& stream)
+{
+
+  class SendFileCoroutine : public oatpp::async::Coroutine<SendFileCoroutine> {
+  private:
+    std::shared_ptr<FileBody> m_body;
+    std::shared_ptr<data::stream::OutputStream> m_stream;
+  public:
+
+    SendFileCoroutine(const std::shared_ptr<FileBody>& body,
+                      const std::shared_ptr<data::stream::OutputStream>& stream)
+      : m_body(body)
+      , m_stream(stream)
+    {}
+
+    Action act() override {
+
+      async::Action action;
+      auto res = m_body->sendFile(m_stream.get(), action);
+
+      if(!action.isNone()) {
+        return action;
+      }
+
+      if(res > 0) {
+        return repeat();
+      }
+
+      switch(res) {
+        case IOError::ZERO_VALUE:
+          return finish();
+        case IOError::RETRY_READ:
+        case IOError::RETRY_WRITE:
+          return repeat();
+        default:
+          return error<AsyncIOError>(IOError::BROKEN_PIPE);
+      }
+
+    }
+
+  };
+
+  return SendFileCoroutine::start(body, stream);
+
+}
+
+}}}}}
@@ -0,0 +1,169 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_outgoing_FileBody_hpp
+#define oatpp_web_protocol_http_outgoing_FileBody_hpp
+
+#include "./Body.hpp"
+#include "oatpp/web/protocol/http/Http.hpp"
+
+#include "oatpp/data/resource/File.hpp"
+#include "oatpp/data/stream/FileStream.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+/**
+ * Implementation of &id:oatpp::web::protocol::http::outgoing::Body; class.
+ * Uses &id:oatpp::data::resource::File; as data source for http body. <br>
+ * Body size is known - `Content-Length` is declared. Supports `Range` requests - &id:oatpp::web::protocol::http::Range;. <br>
+ * When response is sent to a plain &id:oatpp::network::tcp::Connection; the file is sent with `sendfile`
+ * (see &l:FileBody::isZeroCopySupported ();). Otherwise file is read to the transfer buffer.
+ */
+class FileBody : public oatpp::base::Countable, public Body {
+private:
+  data::resource::File m_file;
+  data::stream::FileInputStream m_stream;
+  oatpp::data::share::StringKeyLabel m_contentType;
+  v_int64 m_fileSize;
+  v_int64 m_rangeStart;
+  v_int64 m_rangeEnd;
+  bool m_isRange;
+  v_int64 m_position;
+private:
+  void seekToRangeStart();
+public:
+
+  /**
+   * Constructor. Body contains the whole file.
+   * @param file - &id:oatpp::data::resource::File;.
+   * @param contentType - type of the content.
+   * @throws - `std::runtime_error` if file can't be opened.
+   */
+  FileBody(const data::resource::File& file, const data::share::StringKeyLabel& contentType);
+
+  /**
+   * Constructor. Body contains bytes of the file in the range.
+   * @param file - &id:oatpp::data::resource::File;.
+   * @param range - &id:oatpp::web::protocol::http::Range;.
+   * @param contentType - type of the content.
+   * @throws - &id:oatpp::web::protocol::http::HttpError; with status `416` if range is not satisfiable.
+   */
+  FileBody(const data::resource::File& file, const Range& range, const data::share::StringKeyLabel& contentType);
+
+public:
+
+  /**
+   * Create shared FileBody.
+   * @param file - &id:oatpp::data::resource::File;.
+   * @param contentType - type of the content.
+   * @return - `std::shared_ptr` to FileBody.
+   */
+  static std::shared_ptr<FileBody> createShared(const data::resource::File& file,
+                                                const data::share::StringKeyLabel& contentType = data::share::StringKeyLabel());
+
+  /**
+   * Create shared FileBody for the `Range` request. <br>
+   * *Note: response status should be set to `206 Partial Content`.*
+   * @param file - &id:oatpp::data::resource::File;.
+   * @param range - &id:oatpp::web::protocol::http::Range;.
+   * @param contentType - type of the content.
+   * @return - `std::shared_ptr` to FileBody.
+   */
+  static std::shared_ptr<FileBody> createShared(const data::resource::File& file,
+                                                const Range& range,
+                                                const data::share::StringKeyLabel& contentType = data::share::StringKeyLabel());
+
+  /**
+   * Read operation callback - fallback when zero-copy transfer is not supported.
+   * @param buffer - pointer to buffer.
+   * @param count - size of the buffer in bytes.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written to buffer. 0 - to indicate end-of-file.
+   */
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Declare `Content-Type` and `Content-Range` headers.
+   * @param headers - &id:oatpp::web::protocol::http::Headers;.
+   */
+  void declareHeaders(Headers& headers) override;
+
+  /**
+   * Pointer to the body known data.
+   * @return - `nullptr`.
+   */
+  p_char8 getKnownData() override;
+
+  /**
+   * Return known size of the body - size of the file or size of the range.
+   * @return - `v_int64`.
+   */
+  v_int64 getKnownSize() override;
+
+  /**
+   * Get size of the whole file.
+   * @return - `v_int64`.
+   */
+  v_int64 getFileSize() const;
+
+  /**
+   * Check if body can be sent to the stream with zero-copy (`sendfile`).
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @return - `true` if stream is &id:oatpp::network::tcp::Connection; and platform supports `sendfile`.
+   */
+  static bool isZeroCopySupported(data::stream::OutputStream* stream);
+
+  /**
+   * Send next portion of the body to the stream with zero-copy (`sendfile`). <br>
+   * Call only if &l:FileBody::isZeroCopySupported (); returned `true` for the stream.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes sent. 0 - all body is sent.
+   */
+  v_io_size sendFile(data::stream::OutputStream* stream, async::Action& action);
+
+  /**
+   * Send the whole body to the stream with zero-copy in blocking mode.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @return - actual number of bytes sent.
+   */
+  v_io_size sendFileSimple(data::stream::OutputStream* stream);
+
+  /**
+   * Send the whole body to the stream with zero-copy in async mode.
+   * @param body - `std::shared_ptr` to FileBody.
+   * @param stream - `std::shared_ptr` to &id:oatpp::data::stream::OutputStream;.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  static async::CoroutineStarter sendFileAsync(const std::shared_ptr<FileBody>& body,
+                                               const std::shared_ptr<data::stream::OutputStream>& stream);
+
+};
+
+}}}}}
+
+#endif /* oatpp_web_protocol_http_outgoing_FileBody_hpp */
@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include "./Response.hpp"
+#include "./FileBody.hpp"
 
 #include "oatpp/web/protocol/http/encoding/Chunked.hpp"
 #include "oatpp/utils/Conversion.hpp"
@@ -77,10 +78,26 @@ bool Response::putHeaderIfNotExists_Unsafe(const oatpp::data::share::StringKeyLa
   return m_headers.putIfNotExists(key, value);
 }
 
+void Response::putHeader_Unsafe(http::Header::Id headerId, const oatpp::data::share::StringKeyLabel& value) {
+  m_headers.put(headerId, value);
+}
+
+bool Response::putHeaderIfNotExists_Unsafe(http::Header::Id headerId, const oatpp::data::share::StringKeyLabel& value) {
+  return m_headers.putIfNotExists(headerId, value);
+}
+
+bool Response::putOrReplaceHeader_Unsafe(http::Header::Id headerId, const oatpp::data::share::StringKeyLabel& value) {
+  return m_headers.putOrReplace(headerId, value);
+}
+
 oatpp::String Response::getHeader(const oatpp::data::share::StringKeyLabelCI& headerName) const {
   return m_headers.get(headerName);
 }
 
+oatpp::String Response::getHeader(http::Header::Id headerId) const {
+  return m_headers.get(headerId);
+}
+
 void Response::putBundleData(const oatpp::String& key, const oatpp::Void& polymorph) {
   m_bundle.put(key, polymorph);
 }
@@ -121,18 +138,18 @@ void Response::send(data::stream::OutputStream* stream,
       bodySize = m_body->getKnownSize();
 
       if (bodySize >= 0) {
-        m_headers.put_LockFree(Header::CONTENT_LENGTH, utils::Conversion::int64ToStr(bodySize));
+        m_headers.put(Header::Id::CONTENT_LENGTH, utils::Conversion::int64ToStr(bodySize));
       } else {
-        m_headers.put_LockFree(Header::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
+        m_headers.put(Header::Id::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
       }
 
     } else {
-      m_headers.put_LockFree(Header::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
-      m_headers.put_LockFree(Header::CONTENT_ENCODING, contentEncoderProvider->getEncodingName());
+      m_headers.put(Header::Id::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
+      m_headers.put(Header::Id::CONTENT_ENCODING, contentEncoderProvider->getEncodingName());
     }
 
   } else {
-    m_headers.put_LockFree(Header::CONTENT_LENGTH, "0");
+    m_headers.put(Header::Id::CONTENT_LENGTH, "0");
   }
 
   headersWriteBuffer->setCurrentPosition(0);
@@ -155,16 +172,25 @@ void Response::send(data::stream::OutputStream* stream,
 
         if(m_body->getKnownData() == nullptr) {
           headersWriteBuffer->flushToStream(stream);
-          /* Reuse headers buffer */
-          /* Transfer without chunked encoder */
-          data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity());
+          auto fileBody = std::dynamic_pointer_cast<FileBody>(m_body);
+          if(fileBody && FileBody::isZeroCopySupported(stream)) {
+            fileBody->sendFileSimple(stream);
+          } else {
+            /* Reuse headers buffer */
+            /* Transfer without chunked encoder */
+            data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity());
+          }
         } else { 
           if (bodySize + headersWriteBuffer->getCurrentPosition() < headersWriteBuffer->getCapacity()) {
             headersWriteBuffer->writeSimple(m_body->getKnownData(), bodySize);
             headersWriteBuffer->flushToStream(stream);
           } else {
-            headersWriteBuffer->flushToStream(stream);
-            stream->writeExactSizeDataSimple(m_body->getKnownData(), bodySize);
+            /* Headers and body in one vectored write - no copy */
+            data::buffer::InlineWriteData buffers[2] = {
+              {headersWriteBuffer->getData(), headersWriteBuffer->getCurrentPosition()},
+              {m_body->getKnownData(), bodySize}
+            };
+            stream->writeExactSizeDataSimple(buffers, 2);
           }
         }
       } else {
@@ -213,6 +239,7 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
     std::shared_ptr<data::stream::OutputStream> m_stream;
     std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_headersWriteBuffer;
     std::shared_ptr<http::encoding::EncoderProvider> m_contentEncoderProvider;
+    data::buffer::InlineWriteData m_buffers[2];
   public:
 
     SendAsyncCoroutine(const std::shared_ptr<Response>& _this,
@@ -238,18 +265,18 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
           bodySize = m_this->m_body->getKnownSize();
 
           if (bodySize >= 0) {
-            m_this->m_headers.put_LockFree(Header::CONTENT_LENGTH, utils::Conversion::int64ToStr(bodySize));
+            m_this->m_headers.put(Header::Id::CONTENT_LENGTH, utils::Conversion::int64ToStr(bodySize));
           } else {
-            m_this->m_headers.put_LockFree(Header::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
+            m_this->m_headers.put(Header::Id::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
           }
 
         } else {
-          m_this->m_headers.put_LockFree(Header::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
-          m_this->m_headers.put_LockFree(Header::CONTENT_ENCODING, m_contentEncoderProvider->getEncodingName());
+          m_this->m_headers.put(Header::Id::TRANSFER_ENCODING, Header::Value::TRANSFER_ENCODING_CHUNKED);
+          m_this->m_headers.put(Header::Id::CONTENT_ENCODING, m_contentEncoderProvider->getEncodingName());
         }
 
       } else {
-        m_this->m_headers.put_LockFree(Header::CONTENT_LENGTH, "0");
+        m_this->m_headers.put(Header::Id::CONTENT_LENGTH, "0");
       }
 
       m_headersWriteBuffer->setCurrentPosition(0);
@@ -270,17 +297,32 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
 
           if (bodySize >= 0) {
 
-            if (bodySize + m_headersWriteBuffer->getCurrentPosition() < m_headersWriteBuffer->getCapacity()) {
+            if(m_this->m_body->getKnownData() == nullptr) {
+
+              auto fileBody = std::dynamic_pointer_cast<FileBody>(m_this->m_body);
+              if(fileBody && FileBody::isZeroCopySupported(m_stream.get())) {
+                return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
+                  .next(FileBody::sendFileAsync(fileBody, m_stream))
+                  .next(finish());
+              }
 
-              m_headersWriteBuffer->writeSimple(m_this->m_body->getKnownData(), bodySize);
               return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
+                .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared()))
                 .next(finish());
 
-            } else {
+            } else if (bodySize + m_headersWriteBuffer->getCurrentPosition() < m_headersWriteBuffer->getCapacity()) {
 
+              m_headersWriteBuffer->writeSimple(m_this->m_body->getKnownData(), bodySize);
               return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-                .next(m_stream->writeExactSizeDataAsync(m_this->m_body->getKnownData(), bodySize))
                 .next(finish());
+
+            } else {
+
+              /* Headers and body in one vectored write - no copy */
+              m_buffers[0].set(m_headersWriteBuffer->getData(), m_headersWriteBuffer->getCurrentPosition());
+              m_buffers[1].set(m_this->m_body->getKnownData(), bodySize);
+              return yieldTo(&SendAsyncCoroutine::writeHeadersAndBody);
+
             }
 
           } else {
@@ -316,6 +358,10 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
 
     }
 
+    Action writeHeadersAndBody() {
+      return m_stream->writeExactSizeDataAsyncInline(m_buffers, 2, finish());
+    }
+
   };
 
   return SendAsyncCoroutine::start(_this, stream, headersWriteBuffer, contentEncoder);
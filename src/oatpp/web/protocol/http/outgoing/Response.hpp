@@ -141,6 +141,29 @@ public:
    */
   bool putHeaderIfNotExists_Unsafe(const oatpp::data::share::StringKeyLabelCI& key, const oatpp::data::share::StringKeyLabel& value);
 
+  /**
+   * Add well-known http header.
+   * @param headerId - &id:oatpp::web::protocol::http::Header::Id;.
+   * @param value - &id:oatpp::data::share::StringKeyLabel;.
+   */
+  void putHeader_Unsafe(http::Header::Id headerId, const oatpp::data::share::StringKeyLabel& value);
+
+  /**
+   * Add well-known http header if not already exists.
+   * @param headerId - &id:oatpp::web::protocol::http::Header::Id;.
+   * @param value - &id:oatpp::data::share::StringKeyLabel;.
+   * @return - `true` if header was added.
+   */
+  bool putHeaderIfNotExists_Unsafe(http::Header::Id headerId, const oatpp::data::share::StringKeyLabel& value);
+
+  /**
+   * Replaces or adds well-known header.
+   * @param headerId - &id:oatpp::web::protocol::http::Header::Id;.
+   * @param value - &id:oatpp::data::share::StringKeyLabel;.
+   * @return - `true` if header was replaces, `false` if header was added.
+   */
+  bool putOrReplaceHeader_Unsafe(http::Header::Id headerId, const oatpp::data::share::StringKeyLabel& value);
+
   /**
    * Get header value
    * @param headerName - &id:oatpp::data::share::StringKeyLabelCI;.
@@ -148,6 +171,13 @@ public:
    */
   oatpp::String getHeader(const oatpp::data::share::StringKeyLabelCI& headerName) const;
 
+  /**
+   * Get value of the well-known header. Faster than lookup by name.
+   * @param headerId - &id:oatpp::web::protocol::http::Header::Id;.
+   * @return - &id:oatpp::String;.
+   */
+  oatpp::String getHeader(http::Header::Id headerId) const;
+
   /**
    * Put data to bundle.
    * @param key
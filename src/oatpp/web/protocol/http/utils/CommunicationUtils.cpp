@@ -35,7 +35,7 @@ void CommunicationUtils::considerConnectionState(const std::shared_ptr<protocol:
     return;
   }
 
-  auto outState = response->getHeaders().getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::CONNECTION);
+  auto outState = response->getHeaders().getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::Id::CONNECTION);
   if(outState && outState == Header::Value::CONNECTION_UPGRADE) {
     connectionState = ConnectionState::DELEGATED;
     return;
@@ -43,7 +43,7 @@ void CommunicationUtils::considerConnectionState(const std::shared_ptr<protocol:
   
   if(request) {
     /* If the connection header is present in the request and its value isn't keep-alive, then close */
-    auto connection = request->getHeaders().getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::CONNECTION);
+    auto connection = request->getHeaders().getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::Id::CONNECTION);
     if(connection) {
       if(connection != Header::Value::CONNECTION_KEEP_ALIVE) {
         connectionState = ConnectionState::CLOSING;
@@ -80,7 +80,7 @@ CommunicationUtils::selectEncoder(const std::shared_ptr<http::incoming::Request>
 {
   if(providers && request) {
 
-    auto suggested = request->getHeaders().getAsMemoryLabel<oatpp::data::share::StringKeyLabel>(Header::ACCEPT_ENCODING);
+    auto suggested = request->getHeaders().getAsMemoryLabel<oatpp::data::share::StringKeyLabel>(Header::Id::ACCEPT_ENCODING);
 
     if(suggested) {
 
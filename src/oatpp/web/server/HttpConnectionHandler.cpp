@@ -37,6 +37,44 @@
 
 namespace oatpp { namespace web { namespace server {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpConnectionHandler::IdleConnectionCoroutine
+
+/*
+ * Waits in the IO worker until the complete headers of the next request are read and hands the session to the pool.
+ * A client sending its request slowly doesn't hold a pool thread.
+ */
+class HttpConnectionHandler::IdleConnectionCoroutine : public async::Coroutine<IdleConnectionCoroutine> {
+private:
+  HttpConnectionHandler* m_handler;
+  std::shared_ptr<HttpProcessor::Session> m_session;
+public:
+
+  IdleConnectionCoroutine(HttpConnectionHandler* handler, const std::shared_ptr<HttpProcessor::Session>& session)
+    : m_handler(handler)
+    , m_session(session)
+  {}
+
+  Action act() override {
+    return m_session->readHeadersAsync().next(yieldTo(&IdleConnectionCoroutine::onHeadersRead));
+  }
+
+  Action onHeadersRead() {
+    m_handler->submitSession(m_session);
+    return finish();
+  }
+
+  Action handleError(Error* error) override {
+    /* connection closed or headers are too large - drop the session */
+    (void) error;
+    return finish();
+  }
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpConnectionHandler
+
 void HttpConnectionHandler::onTaskStart(const provider::ResourceHandle<data::stream::IOStream>& connection) {
 
   std::lock_guard<oatpp::concurrency::SpinLock> lock(m_connectionsLock);
@@ -69,12 +107,92 @@ v_uint64 HttpConnectionHandler::getConnectionsCount() {
 HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components)
   : m_components(components)
   , m_continue(true)
+  , m_workersRunning(false)
 {}
 
+HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components, v_int32 threadPoolSize)
+  : m_components(components)
+  , m_continue(true)
+  , m_idleExecutor(std::make_shared<async::Executor>(1, 1, 1))
+  , m_workersRunning(true)
+{
+  if(threadPoolSize < 1) {
+    threadPoolSize = 1;
+  }
+  m_workers.reserve(static_cast<size_t>(threadPoolSize));
+  for(v_int32 i = 0; i < threadPoolSize; i ++) {
+    m_workers.emplace_back(&HttpConnectionHandler::workerLoop, this);
+  }
+}
+
+HttpConnectionHandler::~HttpConnectionHandler() {
+  stopWorkers();
+}
+
 std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router){
   return std::make_shared<HttpConnectionHandler>(router);
 }
 
+std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router, v_int32 threadPoolSize){
+  return std::make_shared<HttpConnectionHandler>(router, threadPoolSize);
+}
+
+void HttpConnectionHandler::submitSession(const std::shared_ptr<HttpProcessor::Session>& session) {
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    m_queue.push_back(session);
+  }
+  m_queueCondition.notify_one();
+}
+
+void HttpConnectionHandler::workerLoop() {
+
+  while(true) {
+
+    std::shared_ptr<HttpProcessor::Session> session;
+
+    {
+      std::unique_lock<std::mutex> lock(m_queueMutex);
+      m_queueCondition.wait(lock, [this]{ return !m_queue.empty() || !m_workersRunning; });
+      if(m_queue.empty()) {
+        return;
+      }
+      session = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+
+    if(m_continue.load() && session->run() == HttpProcessor::ConnectionState::ALIVE) {
+      m_idleExecutor->execute<IdleConnectionCoroutine>(this, session);
+    }
+
+  }
+
+}
+
+void HttpConnectionHandler::stopWorkers() {
+
+  if(!m_idleExecutor) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if(!m_workersRunning) {
+      return;
+    }
+    m_workersRunning = false;
+  }
+  m_queueCondition.notify_all();
+
+  for(auto& worker : m_workers) {
+    worker.join();
+  }
+
+  m_idleExecutor->stop();
+  m_idleExecutor->join();
+
+}
+
 void HttpConnectionHandler::setErrorHandler(const std::shared_ptr<handler::ErrorHandler>& errorHandler){
   m_components->errorHandler = errorHandler;
   if(!m_components->errorHandler) {
@@ -96,6 +214,11 @@ void HttpConnectionHandler::handleConnection(const provider::ResourceHandle<data
 
   (void)params;
 
+  if (m_continue.load() && m_idleExecutor) {
+    m_idleExecutor->execute<IdleConnectionCoroutine>(this, std::make_shared<HttpProcessor::Session>(m_components, connection, this));
+    return;
+  }
+
   if (m_continue.load()) {
 
     connection.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
@@ -130,6 +253,8 @@ void HttpConnectionHandler::stop() {
   while(getConnectionsCount() > 0) {
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
   }
+
+  stopWorkers();
 }
 
 }}}
@@ -28,14 +28,22 @@
 #include "oatpp/web/server/HttpProcessor.hpp"
 #include "oatpp/network/ConnectionHandler.hpp"
 #include "oatpp/concurrency/SpinLock.hpp"
+#include "oatpp/async/Executor.hpp"
 
+#include <condition_variable>
+#include <list>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace oatpp { namespace web { namespace server {
 
 /**
  * Simple ConnectionHandler (&id:oatpp::network::ConnectionHandler;) for handling HTTP communication. <br>
- * Will create one thread per each connection to handle communication.
+ * Will create one thread per each connection to handle communication. <br>
+ * In the worker-pool mode connections are served by a fixed number of threads instead. Connections don't occupy a thread
+ * while idle or while request headers are arriving - headers are read in an &id:oatpp::async::Executor;
+ * and the connection is handed to the pool once the complete headers section is read.
  */
 class HttpConnectionHandler : public base::Countable, public network::ConnectionHandler, public HttpProcessor::TaskProcessingListener {
 protected:
@@ -45,11 +53,24 @@ protected:
 
   void invalidateAllConnections();
 
+private:
+  class IdleConnectionCoroutine;
+private:
+  void submitSession(const std::shared_ptr<HttpProcessor::Session>& session);
+  void workerLoop();
+  void stopWorkers();
 private:
   std::shared_ptr<HttpProcessor::Components> m_components;
   std::atomic_bool m_continue;
   std::unordered_map<v_uint64, provider::ResourceHandle<data::stream::IOStream>> m_connections;
   oatpp::concurrency::SpinLock m_connectionsLock;
+private:
+  std::shared_ptr<async::Executor> m_idleExecutor;
+  std::vector<std::thread> m_workers;
+  std::list<std::shared_ptr<HttpProcessor::Session>> m_queue;
+  std::mutex m_queueMutex;
+  std::condition_variable m_queueCondition;
+  bool m_workersRunning;
 public:
 
   /**
@@ -58,6 +79,27 @@ public:
    */
   HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components);
 
+  /**
+   * Constructor. Worker-pool mode. <br>
+   * Headers of each request are read asynchronously in the I/O worker - a client sending headers slowly doesn't hold a pool thread.
+   * The request body is read and the response is written in the blocking mode on the pool thread. <br>
+   * *Note: a client sending the body or reading the response slowly holds a pool thread until it's done.
+   * Use &id:oatpp::web::server::AsyncHttpConnectionHandler; if that's an issue.*
+   * @param components - &id:oatpp::web::server::HttpProcessor::Components;.
+   * @param threadPoolSize - number of threads serving connections.
+   */
+  HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components, v_int32 threadPoolSize);
+
+  /**
+   * Constructor. Worker-pool mode. <br>
+   * See &l:HttpConnectionHandler::HttpConnectionHandler (const std::shared_ptr<HttpProcessor::Components>& components, v_int32 threadPoolSize);.
+   * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
+   * @param threadPoolSize - number of threads serving connections.
+   */
+  HttpConnectionHandler(const std::shared_ptr<HttpRouter>& router, v_int32 threadPoolSize)
+    : HttpConnectionHandler(std::make_shared<HttpProcessor::Components>(router), threadPoolSize)
+  {}
+
   /**
    * Constructor.
    * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
@@ -85,6 +127,19 @@ public:
    */
   static std::shared_ptr<HttpConnectionHandler> createShared(const std::shared_ptr<HttpRouter>& router);
 
+  /**
+   * Create shared HttpConnectionHandler in the worker-pool mode.
+   * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
+   * @param threadPoolSize - number of threads serving connections.
+   * @return - `std::shared_ptr` to HttpConnectionHandler.
+   */
+  static std::shared_ptr<HttpConnectionHandler> createShared(const std::shared_ptr<HttpRouter>& router, v_int32 threadPoolSize);
+
+  /**
+   * Virtual destructor.
+   */
+  ~HttpConnectionHandler() override;
+
   /**
    * Set root error handler for all requests coming through this Connection Handler.
    * All unhandled errors will be handled by this error handler.
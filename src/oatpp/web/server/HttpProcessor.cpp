@@ -113,7 +113,7 @@ HttpProcessor::processNextRequest(ProcessingResources& resources,
 
     }
 
-    request->setPathVariables(route.getMatchMap());
+    request->setPathVariables(route.takeMatchMap());
     return route.getEndpoint()->handle(request);
 
   } catch (...) {
@@ -170,18 +170,18 @@ HttpProcessor::ConnectionState HttpProcessor::processNextRequest(ProcessingResou
       connectionState = ConnectionState::CLOSING;
     }
 
-    response->putHeaderIfNotExists(protocol::http::Header::SERVER, protocol::http::Header::Value::SERVER);
+    response->putHeaderIfNotExists_Unsafe(protocol::http::Header::Id::SERVER, protocol::http::Header::Value::SERVER);
     protocol::http::utils::CommunicationUtils::considerConnectionState(request, response, connectionState);
 
     switch(connectionState) {
 
       case ConnectionState::ALIVE :
-        response->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
+        response->putHeaderIfNotExists_Unsafe(protocol::http::Header::Id::CONNECTION, protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
         break;
 
       case ConnectionState::CLOSING:
       case ConnectionState::DEAD:
-        response->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_CLOSE);
+        response->putHeaderIfNotExists_Unsafe(protocol::http::Header::Id::CONNECTION, protocol::http::Header::Value::CONNECTION_CLOSE);
         break;
 
       case ConnectionState::DELEGATED:
@@ -270,6 +270,63 @@ void HttpProcessor::Task::run(){
 
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpProcessor::Session
+
+HttpProcessor::Session::Session(const std::shared_ptr<Components>& components,
+                                const provider::ResourceHandle<oatpp::data::stream::IOStream>& connection,
+                                TaskProcessingListener* taskListener)
+  : m_resources(components, connection)
+  , m_taskListener(taskListener)
+  , m_initialized(false)
+{
+  m_taskListener->onTaskStart(m_resources.connection);
+}
+
+HttpProcessor::Session::~Session() {
+  m_taskListener->onTaskEnd(m_resources.connection);
+}
+
+async::CoroutineStarter HttpProcessor::Session::readHeadersAsync() {
+
+  const auto& connection = m_resources.connection.object;
+
+  connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+  connection->setInputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+
+  if(!m_initialized) {
+    m_initialized = true;
+    auto pipeline = connection->initContextsAsync();
+    return std::move(pipeline.next(m_resources.headersReader.bufferHeadersAsync(m_resources.inStream)));
+  }
+
+  return m_resources.headersReader.bufferHeadersAsync(m_resources.inStream);
+
+}
+
+HttpProcessor::ConnectionState HttpProcessor::Session::run() {
+
+  const auto& connection = m_resources.connection.object;
+
+  connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+  connection->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+
+  /*
+   * Process one request only - headers of the next pipelined request may be incomplete,
+   * so they are read in the async mode as well.
+   */
+  try {
+    return HttpProcessor::processNextRequest(m_resources);
+  } catch (std::exception& e) {
+    OATPP_LOGE("[oatpp::web::server::HttpProcessor::Session::run()]", "Error. Unhandled exception '%s'. Dropping connection", e.what())
+  } catch (...) {
+    OATPP_LOGE("[oatpp::web::server::HttpProcessor::Session::run()]", "Error. Unhandled unknown exception. Dropping connection")
+  }
+
+  return ConnectionState::DEAD;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // HttpProcessor::Coroutine
 
@@ -329,7 +386,7 @@ oatpp::async::Action HttpProcessor::Coroutine::onHeadersParsed(const RequestHead
     return yieldTo(&HttpProcessor::Coroutine::onResponseFormed);
   }
 
-  m_currentRequest->setPathVariables(m_currentRoute.getMatchMap());
+  m_currentRequest->setPathVariables(m_currentRoute.takeMatchMap());
 
   return yieldTo(&HttpProcessor::Coroutine::onRequestFormed);
 
@@ -355,18 +412,18 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponseFormed() {
     }
   }
 
-  m_currentResponse->putHeaderIfNotExists(protocol::http::Header::SERVER, protocol::http::Header::Value::SERVER);
+  m_currentResponse->putHeaderIfNotExists_Unsafe(protocol::http::Header::Id::SERVER, protocol::http::Header::Value::SERVER);
   oatpp::web::protocol::http::utils::CommunicationUtils::considerConnectionState(m_currentRequest, m_currentResponse, m_connectionState);
 
   switch(m_connectionState) {
 
     case ConnectionState::ALIVE :
-      m_currentResponse->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
+      m_currentResponse->putHeaderIfNotExists_Unsafe(protocol::http::Header::Id::CONNECTION, protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
       break;
 
     case ConnectionState::CLOSING:
     case ConnectionState::DEAD:
-      m_currentResponse->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_CLOSE);
+      m_currentResponse->putHeaderIfNotExists_Unsafe(protocol::http::Header::Id::CONNECTION, protocol::http::Header::Value::CONNECTION_CLOSE);
       break;
 
     case ConnectionState::DELEGATED:
@@ -244,6 +244,54 @@ public:
     void run();
 
   };
+
+public:
+
+  /**
+   * Connection serving session for a pool of threads. <br>
+   * Unlike &l:HttpProcessor::Task; it doesn't occupy a thread while the connection is idle or the request headers
+   * are still arriving - &l:HttpProcessor::Session::readHeadersAsync (); waits for the complete headers section
+   * in an &id:oatpp::async::Executor;, then &l:HttpProcessor::Session::run (); processes the request on a thread.
+   */
+  class Session : public base::Countable {
+  private:
+    ProcessingResources m_resources;
+    TaskProcessingListener* m_taskListener;
+    bool m_initialized;
+  public:
+
+    /**
+     * Constructor.
+     * @param components - &l:HttpProcessor::Components;.
+     * @param connection - &id:oatpp::data::stream::IOStream;.
+     * @param taskListener - &l:HttpProcessor::TaskProcessingListener;.
+     */
+    Session(const std::shared_ptr<Components>& components,
+            const provider::ResourceHandle<oatpp::data::stream::IOStream>& connection,
+            TaskProcessingListener* taskListener);
+
+    Session(const Session&) = delete;
+    Session &operator=(const Session&) = delete;
+
+    /**
+     * Destructor, needed for counting.
+     */
+    ~Session() override;
+
+    /**
+     * Switch the connection to the async mode and read headers section of the next request without parsing it.
+     * Initializes connection contexts on the first call.
+     * @return - &id:oatpp::async::CoroutineStarter;.
+     */
+    async::CoroutineStarter readHeadersAsync();
+
+    /**
+     * Process the request which headers were read by &l:HttpProcessor::Session::readHeadersAsync (); in blocking mode.
+     * @return - `ConnectionState::ALIVE` if the connection should wait for the next request.
+     */
+    ConnectionState run();
+
+  };
   
 public:
 
@@ -163,14 +163,14 @@ bool Pattern::match(const StringKeyLabel& url, MatchMap& matchMap) {
       v_char8 a = findSysChar(caret);
       if(a == '?') {
         if(curr == end || (*curr)->function == Part::FUNCTION_ANY_END) {
-          matchMap.m_variables[part->text] = StringKeyLabel(url.getMemoryHandle(), label.getData(), label.getSize());
+          matchMap.m_variables.put(part->text, StringKeyLabel(url.getMemoryHandle(), label.getData(), label.getSize()));
           matchMap.m_tail = StringKeyLabel(url.getMemoryHandle(), caret.getCurrData(), caret.getDataSize() - caret.getPosition());
           return true;
         }
         caret.findChar('/');
       }
       
-      matchMap.m_variables[part->text] = StringKeyLabel(url.getMemoryHandle(), label.getData(), label.getSize());
+      matchMap.m_variables.put(part->text, StringKeyLabel(url.getMemoryHandle(), label.getData(), label.getSize()));
       
     }
     
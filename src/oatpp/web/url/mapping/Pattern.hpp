@@ -30,19 +30,203 @@
 #include "oatpp/utils/parser/Caret.hpp"
 
 #include <list>
-#include <unordered_map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace oatpp { namespace web { namespace url { namespace mapping {
-  
+
+class RadixTree;
+
 class Pattern : public base::Countable{
+  friend RadixTree;
 private:
   typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
 public:
   
   class MatchMap {
     friend Pattern;
+    friend RadixTree;
   public:
-    typedef std::unordered_map<StringKeyLabel, StringKeyLabel> Variables;
+
+    /**
+     * Path variables captured by the route. <br>
+     * Up to &l:Pattern::MatchMap::Variables::INLINE_CAPACITY; variables are stored inline - no heap allocations.
+     * Names and values are labels over the memory of the pattern and the matched path. <br>
+     * *Note: this used to be a typedef of `std::unordered_map<StringKeyLabel, StringKeyLabel>`.
+     * Lookup (`find`, `at`, `count`), iteration and `size` are kept, other `std::unordered_map` operations are not available.*
+     */
+    class Variables {
+    public:
+
+      /**
+       * Number of variables stored without heap allocation.
+       */
+      static constexpr v_buff_size INLINE_CAPACITY = 8;
+
+      /**
+       * Variable name - variable value.
+       */
+      typedef std::pair<StringKeyLabel, StringKeyLabel> Entry;
+
+    private:
+      Entry m_inline[INLINE_CAPACITY];
+      std::vector<Entry> m_overflow;
+      v_buff_size m_size;
+    private:
+
+      Entry* data() {
+        return m_overflow.empty() ? m_inline : m_overflow.data();
+      }
+
+      void releaseInline(v_buff_size from) {
+        for(v_buff_size i = from; i < m_size && i < INLINE_CAPACITY; i ++) {
+          m_inline[i] = Entry();
+        }
+      }
+
+      void copyFrom(const Variables& other) {
+        v_buff_size i = 0;
+        if(other.m_overflow.empty()) {
+          for(; i < other.m_size; i ++) {
+            m_inline[i] = other.m_inline[i];
+          }
+        }
+        releaseInline(i);
+        m_overflow = other.m_overflow;
+        m_size = other.m_size;
+      }
+
+      void moveFrom(Variables& other) {
+        v_buff_size i = 0;
+        if(other.m_overflow.empty()) {
+          for(; i < other.m_size; i ++) {
+            m_inline[i] = std::move(other.m_inline[i]);
+          }
+        }
+        releaseInline(i);
+        m_overflow = std::move(other.m_overflow);
+        other.m_overflow.clear();
+        m_size = other.m_size;
+        other.m_size = 0;
+      }
+
+    public:
+
+      Variables() : m_size(0) {}
+
+      /* copy/move only the entries in use */
+
+      Variables(const Variables& other) : m_size(0) {
+        copyFrom(other);
+      }
+
+      Variables(Variables&& other) noexcept : m_size(0) {
+        moveFrom(other);
+      }
+
+      Variables& operator=(const Variables& other) {
+        if(this != &other) {
+          copyFrom(other);
+        }
+        return *this;
+      }
+
+      Variables& operator=(Variables&& other) noexcept {
+        if(this != &other) {
+          moveFrom(other);
+        }
+        return *this;
+      }
+
+      /**
+       * Set variable. Replaces value if variable with the same name is already present.
+       * @param name - variable name.
+       * @param value - variable value.
+       */
+      void put(const StringKeyLabel& name, const StringKeyLabel& value) {
+        auto entries = data();
+        for(v_buff_size i = 0; i < m_size; i ++) {
+          if(entries[i].first == name) {
+            entries[i].second = value;
+            return;
+          }
+        }
+        if(m_size < INLINE_CAPACITY) {
+          m_inline[m_size] = {name, value};
+        } else {
+          if(m_overflow.empty()) {
+            m_overflow.reserve(static_cast<size_t>(INLINE_CAPACITY * 2));
+            m_overflow.insert(m_overflow.end(), m_inline, m_inline + INLINE_CAPACITY);
+          }
+          m_overflow.push_back({name, value});
+        }
+        m_size ++;
+      }
+
+      /**
+       * Find variable by name.
+       * @param name - variable name.
+       * @return - pointer to the entry or `end()` if not found.
+       */
+      const Entry* find(const StringKeyLabel& name) const {
+        auto it = begin();
+        const auto e = end();
+        while(it != e && it->first != name) {
+          ++ it;
+        }
+        return it;
+      }
+
+      /**
+       * Get variable value by name.
+       * @param name - variable name.
+       * @return - variable value.
+       * @throws - `std::out_of_range` if not found.
+       */
+      const StringKeyLabel& at(const StringKeyLabel& name) const {
+        auto it = find(name);
+        if(it == end()) {
+          throw std::out_of_range("[oatpp::web::url::mapping::Pattern::MatchMap::Variables::at()]: Error. No such variable.");
+        }
+        return it->second;
+      }
+
+      /**
+       * Count variables with the name.
+       * @param name - variable name.
+       * @return - `1` if variable is present, `0` otherwise.
+       */
+      size_t count(const StringKeyLabel& name) const {
+        return find(name) != end() ? 1 : 0;
+      }
+
+      const Entry* begin() const {
+        return m_overflow.empty() ? m_inline : m_overflow.data();
+      }
+
+      const Entry* end() const {
+        return begin() + m_size;
+      }
+
+      size_t size() const {
+        return static_cast<size_t>(m_size);
+      }
+
+      bool empty() const {
+        return m_size == 0;
+      }
+
+      void clear() {
+        for(v_buff_size i = 0; i < m_size && i < INLINE_CAPACITY; i ++) {
+          m_inline[i] = Entry();
+        }
+        m_overflow.clear();
+        m_size = 0;
+      }
+
+    };
+
   private:
     Variables m_variables;
     StringKeyLabel m_tail;
@@ -62,6 +246,19 @@ public:
       }
       return nullptr;
     }
+
+    /**
+     * Get variable value as a label over the matched path. Doesn't copy the value.
+     * @param key - variable name.
+     * @return - &id:oatpp::data::share::StringKeyLabel;. Empty label if variable not found.
+     */
+    StringKeyLabel getVariableLabel(const StringKeyLabel& key) const {
+      auto it = m_variables.find(key);
+      if(it != m_variables.end()) {
+        return it->second;
+      }
+      return nullptr;
+    }
     
     oatpp::String getTail() const {
       return m_tail.toString();
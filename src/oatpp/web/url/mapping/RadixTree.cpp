@@ -0,0 +1,271 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RadixTree.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+namespace {
+
+bool compareText(const char* data1, v_buff_size size1, const char* data2, v_buff_size size2) {
+  auto result = std::memcmp(data1, data2, static_cast<size_t>(std::min(size1, size2)));
+  if(result != 0) {
+    return result < 0;
+  }
+  return size1 < size2;
+}
+
+}
+
+RadixTree::Node::Node()
+  : endIndex(-1)
+  , tailIndex(-1)
+  , minIndex(std::numeric_limits<v_int64>::max())
+{}
+
+RadixTree::Node* RadixTree::Node::getConstChild(const char* text, v_buff_size size) const {
+  auto it = std::lower_bound(constChildren.begin(), constChildren.end(), size, [text](const ConstEdge& edge, v_buff_size textSize) {
+    return compareText(edge.text.data(), static_cast<v_buff_size>(edge.text.size()), text, textSize);
+  });
+  if(it != constChildren.end() && static_cast<v_buff_size>(it->text.size()) == size && std::memcmp(it->text.data(), text, static_cast<size_t>(size)) == 0) {
+    return it->node.get();
+  }
+  return nullptr;
+}
+
+RadixTree::Node* RadixTree::Node::obtainConstChild(const std::string& text) {
+  auto it = std::lower_bound(constChildren.begin(), constChildren.end(), text, [](const ConstEdge& edge, const std::string& t) {
+    return edge.text < t;
+  });
+  if(it != constChildren.end() && it->text == text) {
+    return it->node.get();
+  }
+  ConstEdge edge;
+  edge.text = text;
+  edge.node.reset(new Node());
+  it = constChildren.insert(it, std::move(edge));
+  return it->node.get();
+}
+
+v_buff_size RadixTree::findChar(const MatchState& state, v_buff_size pos, char c) {
+  while(pos < state.size && state.data[pos] != c) {
+    pos ++;
+  }
+  return pos;
+}
+
+v_buff_size RadixTree::findSysChar(const MatchState& state, v_buff_size pos) {
+  while(pos < state.size && state.data[pos] != '/' && state.data[pos] != '?') {
+    pos ++;
+  }
+  return pos;
+}
+
+void RadixTree::onCandidate(MatchState& state, v_int64 index, v_buff_size tailPosition) {
+  if(index < state.index) {
+    state.index = index;
+    std::copy(state.captures, state.captures + state.capturesCount, state.resultCaptures);
+    state.resultCapturesCount = state.capturesCount;
+    if(tailPosition >= 0 && tailPosition < state.size) {
+      state.tail = {tailPosition, state.size - tailPosition};
+    } else {
+      state.tail = {-1, 0};
+    }
+  }
+}
+
+void RadixTree::match(const Node* node, v_buff_size pos, MatchState& state) const {
+
+  if(node->minIndex >= state.index) {
+    return;
+  }
+
+  /* same as in Pattern::match() - any number of '/' separates parts */
+  while(pos < state.size && state.data[pos] == '/') {
+    pos ++;
+  }
+
+  if(node->endIndex >= 0 && pos == state.size) {
+    onCandidate(state, node->endIndex, -1);
+  }
+
+  if(node->tailIndex >= 0) {
+    onCandidate(state, node->tailIndex, pos);
+  }
+
+  if(pos == state.size) {
+    return;
+  }
+
+  if(!node->constChildren.empty()) {
+
+    /* const part must be followed by '/', '?', or the end of the path. Query may only follow the last part or the part followed by tail */
+    v_buff_size segmentEnd = findChar(state, pos, '/');
+    v_buff_size boundary = pos;
+
+    while(true) {
+
+      while(boundary < segmentEnd && state.data[boundary] != '?') {
+        boundary ++;
+      }
+
+      auto child = node->getConstChild(state.data + pos, boundary - pos);
+      if(child) {
+        if(boundary < segmentEnd) {
+          if(child->endIndex >= 0) onCandidate(state, child->endIndex, boundary);
+          if(child->tailIndex >= 0) onCandidate(state, child->tailIndex, boundary);
+        } else {
+          match(child, boundary, state);
+        }
+      }
+
+      if(boundary >= segmentEnd) {
+        break;
+      }
+      boundary ++;
+
+    }
+
+  }
+
+  if(node->varChild) {
+
+    const Node* child = node->varChild.get();
+    v_buff_size end = findSysChar(state, pos);
+
+    if(end < state.size && state.data[end] == '?') {
+
+      state.captures[state.capturesCount ++] = {pos, end - pos};
+      if(child->endIndex >= 0) onCandidate(state, child->endIndex, end);
+      if(child->tailIndex >= 0) onCandidate(state, child->tailIndex, end);
+
+      /* Pattern::match() skips query up to the next '/' and keeps it in the variable */
+      end = findChar(state, end, '/');
+      state.captures[state.capturesCount - 1].size = end - pos;
+
+    } else {
+      state.captures[state.capturesCount ++] = {pos, end - pos};
+    }
+
+    match(child, end, state);
+    state.capturesCount --;
+
+  }
+
+}
+
+v_int64 RadixTree::add(const Pattern& pattern) {
+
+  auto index = static_cast<v_int64>(m_variables.size());
+  m_variables.emplace_back();
+  auto& variables = m_variables.back();
+
+  Node* node = &m_root;
+  node->minIndex = std::min(node->minIndex, index);
+
+  for(const auto& part : *pattern.m_parts) {
+
+    if(part->function == Pattern::Part::FUNCTION_CONST) {
+      node = node->obtainConstChild(*part->text);
+    } else if(part->function == Pattern::Part::FUNCTION_VAR) {
+      if(!node->varChild) {
+        node->varChild.reset(new Node());
+      }
+      node = node->varChild.get();
+      variables.push_back(StringKeyLabel(part->text));
+      m_maxVariables = std::max(m_maxVariables, static_cast<v_buff_size>(variables.size()));
+    } else if(part->function == Pattern::Part::FUNCTION_ANY_END) {
+      if(node->tailIndex < 0) {
+        node->tailIndex = index;
+      }
+      return index;
+    }
+
+    node->minIndex = std::min(node->minIndex, index);
+
+  }
+
+  if(node->endIndex < 0) {
+    node->endIndex = index;
+  }
+
+  return index;
+
+}
+
+v_int64 RadixTree::match(const StringKeyLabel& path, Pattern::MatchMap& matchMap) const {
+
+  static constexpr v_buff_size INLINE_CAPACITY = Pattern::MatchMap::Variables::INLINE_CAPACITY;
+
+  Capture captures[INLINE_CAPACITY];
+  Capture resultCaptures[INLINE_CAPACITY];
+  std::vector<Capture> capturesBuffer;
+
+  MatchState state;
+  state.data = reinterpret_cast<const char*>(path.getData());
+  state.size = path.getSize();
+  state.index = std::numeric_limits<v_int64>::max();
+  state.capturesCount = 0;
+  state.resultCapturesCount = 0;
+  state.tail = {-1, 0};
+
+  if(m_maxVariables <= INLINE_CAPACITY) {
+    state.captures = captures;
+    state.resultCaptures = resultCaptures;
+  } else {
+    capturesBuffer.resize(static_cast<size_t>(m_maxVariables * 2));
+    state.captures = capturesBuffer.data();
+    state.resultCaptures = capturesBuffer.data() + m_maxVariables;
+  }
+
+  match(&m_root, 0, state);
+
+  if(state.index == std::numeric_limits<v_int64>::max()) {
+    return -1;
+  }
+
+  const auto& variables = m_variables[static_cast<size_t>(state.index)];
+  for(v_buff_size i = 0; i < state.resultCapturesCount; i ++) {
+    const auto& capture = state.resultCaptures[i];
+    matchMap.m_variables.put(variables[static_cast<size_t>(i)], StringKeyLabel(path.getMemoryHandle(), state.data + capture.start, capture.size));
+  }
+
+  if(state.tail.start >= 0) {
+    matchMap.m_tail = StringKeyLabel(path.getMemoryHandle(), state.data + state.tail.start, state.tail.size);
+  }
+
+  return state.index;
+
+}
+
+v_int64 RadixTree::size() const {
+  return static_cast<v_int64>(m_variables.size());
+}
+
+}}}}
@@ -0,0 +1,139 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_url_mapping_RadixTree_hpp
+#define oatpp_web_url_mapping_RadixTree_hpp
+
+#include "./Pattern.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+/**
+ * Radix tree of path-patterns. <br>
+ * Static segments, `{var}` captures and `*` tails are stored as tree edges so that
+ * resolving a path costs O(path length) instead of matching each &id:oatpp::web::url::mapping::Pattern; in turn. <br>
+ * Resolves to the same pattern as matching patterns one by one in the order they were added -
+ * when several patterns match, the one added first wins.
+ */
+class RadixTree : public base::Countable {
+private:
+  typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+private:
+
+  struct Node;
+
+  struct ConstEdge {
+    std::string text;
+    std::unique_ptr<Node> node;
+  };
+
+  struct Node {
+
+    Node();
+
+    /*
+     * Static children sorted by text.
+     */
+    std::vector<ConstEdge> constChildren;
+    std::unique_ptr<Node> varChild;
+
+    /*
+     * Index of the first pattern ending at this node, or -1.
+     */
+    v_int64 endIndex;
+
+    /*
+     * Index of the first pattern having `*` tail right after this node, or -1.
+     */
+    v_int64 tailIndex;
+
+    /*
+     * Minimum pattern index in the subtree. Used to skip branches which can't produce a better match.
+     */
+    v_int64 minIndex;
+
+    Node* getConstChild(const char* text, v_buff_size size) const;
+    Node* obtainConstChild(const std::string& text);
+
+  };
+
+  struct Capture {
+    v_buff_size start;
+    v_buff_size size;
+  };
+
+  struct MatchState {
+    const char* data;
+    v_buff_size size;
+    v_int64 index;
+    Capture* captures;
+    v_buff_size capturesCount;
+    Capture* resultCaptures;
+    v_buff_size resultCapturesCount;
+    Capture tail;
+  };
+
+private:
+  static v_buff_size findChar(const MatchState& state, v_buff_size pos, char c);
+  static v_buff_size findSysChar(const MatchState& state, v_buff_size pos);
+  static void onCandidate(MatchState& state, v_int64 index, v_buff_size tailPosition);
+  void match(const Node* node, v_buff_size pos, MatchState& state) const;
+private:
+  Node m_root;
+  std::vector<std::vector<StringKeyLabel>> m_variables;
+  v_buff_size m_maxVariables = 0;
+public:
+
+  /**
+   * Add pattern to the tree.
+   * @param pattern - &id:oatpp::web::url::mapping::Pattern;.
+   * @return - index of added pattern. Indexes are assigned sequentially starting from `0`.
+   */
+  v_int64 add(const Pattern& pattern);
+
+  /**
+   * Resolve path to the index of the first added pattern which matches the path. <br>
+   * Doesn't allocate as long as patterns have no more than &id:oatpp::web::url::mapping::Pattern::MatchMap::Variables::INLINE_CAPACITY; variables.
+   * @param path - path to resolve.
+   * @param matchMap - &id:oatpp::web::url::mapping::Pattern::MatchMap; to put resolved path variables and tail to.
+   * @return - index of the matched pattern or `-1` if no pattern matches.
+   */
+  v_int64 match(const StringKeyLabel& path, Pattern::MatchMap& matchMap) const;
+
+  /**
+   * Get number of added patterns.
+   * @return
+   */
+  v_int64 size() const;
+
+};
+
+}}}}
+
+#endif /* oatpp_web_url_mapping_RadixTree_hpp */
@@ -25,17 +25,20 @@
 #ifndef oatpp_web_url_mapping_Router_hpp
 #define oatpp_web_url_mapping_Router_hpp
 
-#include "./Pattern.hpp"
+#include "./RadixTree.hpp"
 
 #include "oatpp/Types.hpp"
 
 #include <utility>
-#include <list>
+#include <stdexcept>
+#include <vector>
 
 namespace oatpp { namespace web { namespace url { namespace mapping {
 
 /**
- * Class responsible to map "Path" to "Route" by "Path-Pattern".
+ * Class responsible to map "Path" to "Route" by "Path-Pattern". <br>
+ * Patterns are resolved with &id:oatpp::web::url::mapping::RadixTree;. If several patterns match the path,
+ * the one added first wins.
  * @tparam Endpoint - endpoint of the route.
  */
 template<typename Endpoint>
@@ -78,7 +81,7 @@ public:
     Route(const Endpoint& endpoint, Pattern::MatchMap&& matchMap)
       : m_valid(true)
       , m_endpoint(endpoint)
-      , m_matchMap(matchMap)
+      , m_matchMap(std::move(matchMap))
     {}
 
     /**
@@ -95,6 +98,14 @@ public:
       return m_matchMap;
     }
 
+    /**
+     * Move match map out of the route. The route is left with an empty match map.
+     * @return - &id:oatpp::web::url::mapping::Pattern::MatchMap;.
+     */
+    Pattern::MatchMap takeMatchMap() {
+      return std::move(m_matchMap);
+    }
+
     /**
      * Check if route is valid.
      * @return
@@ -110,7 +121,8 @@ public:
   };
   
 private:
-  std::list<Pair> m_endpointsByPattern;
+  std::vector<Pair> m_endpointsByPattern;
+  RadixTree m_tree;
 public:
   
   static std::shared_ptr<Router> createShared(){
@@ -124,6 +136,10 @@ public:
    */
   void route(const oatpp::String& pathPattern, const Endpoint& endpoint) {
     auto pattern = Pattern::parse(pathPattern);
+    if(!pattern) {
+      throw std::runtime_error("[oatpp::web::url::mapping::Router::route()]: Error. Invalid path pattern.");
+    }
+    m_tree.add(*pattern);
     m_endpointsByPattern.push_back({pattern, endpoint});
   }
 
@@ -134,11 +150,10 @@ public:
    */
   Route getRoute(const StringKeyLabel& path){
 
-    for(auto& pair : m_endpointsByPattern) {
-      Pattern::MatchMap matchMap;
-      if(pair.first->match(path, matchMap)) {
-        return Route(pair.second, std::move(matchMap));
-      }
+    Pattern::MatchMap matchMap;
+    auto index = m_tree.match(path, matchMap);
+    if(index >= 0) {
+      return Route(m_endpointsByPattern[static_cast<size_t>(index)].second, std::move(matchMap));
     }
 
     return Route();
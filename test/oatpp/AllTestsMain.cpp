@@ -1,4 +1,5 @@
 
+#include "oatpp/web/ClientPipelineTest.hpp"
 #include "oatpp/web/ClientRetryTest.hpp"
 #include "oatpp/web/FullTest.hpp"
 #include "oatpp/web/FullAsyncTest.hpp"
@@ -6,17 +7,23 @@
 #include "oatpp/web/PipelineTest.hpp"
 #include "oatpp/web/PipelineAsyncTest.hpp"
 #include "oatpp/web/protocol/http/encoding/ChunkedTest.hpp"
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReaderTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/FileBodyTest.hpp"
 #include "oatpp/web/server/api/ApiControllerTest.hpp"
 #include "oatpp/web/server/handler/AuthorizationHandlerTest.hpp"
 #include "oatpp/web/server/HttpRouterTest.hpp"
 #include "oatpp/web/server/ServerStopTest.hpp"
 #include "oatpp/web/mime/multipart/StatefulParserTest.hpp"
+#include "oatpp/web/url/mapping/RouterTest.hpp"
+#include "oatpp/web/url/mapping/RouterPerfTest.hpp"
 
 #include "oatpp/network/virtual_/PipeTest.hpp"
 #include "oatpp/network/virtual_/InterfaceTest.hpp"
 #include "oatpp/network/UrlTest.hpp"
 #include "oatpp/network/ConnectionPoolTest.hpp"
 #include "oatpp/network/monitor/ConnectionMonitorTest.hpp"
+#include "oatpp/network/tcp/ConnectionProviderTest.hpp"
+#include "oatpp/network/tcp/ConnectionTest.hpp"
 
 #include "oatpp/json/DeserializerTest.hpp"
 #include "oatpp/json/DTOMapperPerfTest.hpp"
@@ -32,8 +39,14 @@
 #include "oatpp/utils/parser/CaretTest.hpp"
 #include "oatpp/provider/PoolTest.hpp"
 #include "oatpp/provider/PoolTemplateTest.hpp"
+#include "oatpp/provider/SchedulerTest.hpp"
 #include "oatpp/async/ConditionVariableTest.hpp"
 #include "oatpp/async/LockTest.hpp"
+#include "oatpp/async/ExecutorPerfTest.hpp"
+#include "oatpp/async/TimerPerfTest.hpp"
+#include "oatpp/async/FrameAllocatorTest.hpp"
+#include "oatpp/async/IOEventWorkerPerfTest.hpp"
+#include "oatpp/async/IOUringWorkerTest.hpp"
 
 #include "oatpp/data/type/UnorderedMapTest.hpp"
 #include "oatpp/data/type/PairListTest.hpp"
@@ -58,6 +71,7 @@
 #include "oatpp/data/mapping/ObjectToTreeMapperTest.hpp"
 #include "oatpp/data/mapping/TreeToObjectMapperTest.hpp"
 
+#include "oatpp/data/share/LazyStringFlatMapTest.hpp"
 #include "oatpp/data/share/LazyStringMapTest.hpp"
 #include "oatpp/data/share/StringTemplateTest.hpp"
 #include "oatpp/data/share/MemoryLabelTest.hpp"
@@ -108,6 +122,7 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::base::CommandLineArgumentsTest);
 
   OATPP_RUN_TEST(oatpp::data::share::MemoryLabelTest);
+  OATPP_RUN_TEST(oatpp::data::share::LazyStringFlatMapTest);
   OATPP_RUN_TEST(oatpp::data::share::LazyStringMapTest);
   OATPP_RUN_TEST(oatpp::data::share::StringTemplateTest);
 
@@ -139,13 +154,19 @@ void runTests() {
 
   OATPP_RUN_TEST(oatpp::data::resource::InMemoryDataTest);
 
+  OATPP_RUN_TEST(oatpp::async::FrameAllocatorTest);
   OATPP_RUN_TEST(oatpp::async::ConditionVariableTest);
   OATPP_RUN_TEST(oatpp::async::LockTest);
+  OATPP_RUN_TEST(oatpp::async::ExecutorPerfTest);
+  OATPP_RUN_TEST(oatpp::async::TimerPerfTest);
+  OATPP_RUN_TEST(oatpp::async::IOEventWorkerPerfTest);
+  OATPP_RUN_TEST(oatpp::async::IOUringWorkerTest);
 
   OATPP_RUN_TEST(oatpp::utils::parser::CaretTest);
 
   OATPP_RUN_TEST(oatpp::provider::PoolTest);
   OATPP_RUN_TEST(oatpp::provider::PoolTemplateTest);
+  OATPP_RUN_TEST(oatpp::provider::SchedulerTest);
 
   OATPP_RUN_TEST(oatpp::json::EnumTest);
   OATPP_RUN_TEST(oatpp::json::BooleanTest);
@@ -164,13 +185,20 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::test::network::UrlTest);
   OATPP_RUN_TEST(oatpp::test::network::ConnectionPoolTest);
   OATPP_RUN_TEST(oatpp::test::network::monitor::ConnectionMonitorTest);
+  OATPP_RUN_TEST(oatpp::test::network::tcp::ConnectionProviderTest);
+  OATPP_RUN_TEST(oatpp::test::network::tcp::ConnectionTest);
   OATPP_RUN_TEST(oatpp::test::network::virtual_::PipeTest);
   OATPP_RUN_TEST(oatpp::test::network::virtual_::InterfaceTest);
 
   OATPP_RUN_TEST(oatpp::test::web::protocol::http::encoding::ChunkedTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::incoming::RequestHeadersReaderTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::FileBodyTest);
 
   OATPP_RUN_TEST(oatpp::test::web::mime::multipart::StatefulParserTest);
 
+  OATPP_RUN_TEST(oatpp::test::web::url::mapping::RouterTest);
+  OATPP_RUN_TEST(oatpp::test::web::url::mapping::RouterPerfTest);
+
   OATPP_RUN_TEST(oatpp::test::web::server::HttpRouterTest);
   OATPP_RUN_TEST(oatpp::test::web::server::api::ApiControllerTest);
   OATPP_RUN_TEST(oatpp::test::web::server::handler::AuthorizationHandlerTest);
@@ -193,6 +221,12 @@ void runTests() {
     oatpp::test::web::PipelineTest test_port(8000, 3000);
     test_port.run();
 
+    oatpp::test::web::PipelineTest test_virtual_pool(0, 3000, 2);
+    test_virtual_pool.run();
+
+    oatpp::test::web::PipelineTest test_port_pool(8000, 3000, 2);
+    test_port_pool.run();
+
   }
 
   {
@@ -223,6 +257,9 @@ void runTests() {
     oatpp::test::web::FullAsyncTest test_port(8000, 5);
     test_port.run();
 
+    oatpp::test::web::FullAsyncTest test_uring(8000, 5, oatpp::async::Executor::IO_WORKER_TYPE_URING);
+    test_uring.run();
+
   }
 
   {
@@ -245,6 +282,16 @@ void runTests() {
 
   }
 
+  {
+
+    oatpp::test::web::ClientPipelineTest test_virtual(0, 50);
+    test_virtual.run();
+
+    oatpp::test::web::ClientPipelineTest test_port(8000, 50);
+    test_port.run();
+
+  }
+
 
 
 }
@@ -115,6 +115,38 @@ public:
 
 };
 
+class TestCoroutineTimeoutLatency : public oatpp::async::Coroutine<TestCoroutineTimeoutLatency> {
+private:
+  oatpp::async::LockGuard m_lockGuard;
+  oatpp::async::ConditionVariable* m_cv;
+  std::atomic<v_int64>* m_maxLatency;
+  v_int64 m_timePoint;
+public:
+
+  TestCoroutineTimeoutLatency(oatpp::async::Lock* lock,
+                              oatpp::async::ConditionVariable* cv,
+                              std::atomic<v_int64>* maxLatency)
+    : m_lockGuard(lock)
+    , m_cv(cv)
+    , m_maxLatency(maxLatency)
+    , m_timePoint(0)
+  {}
+
+  Action act() override {
+    m_timePoint = oatpp::Environment::getMicroTickCount() + 20 * 1000;
+    return m_cv->waitFor(m_lockGuard, []{return false;}, std::chrono::milliseconds(20))
+      .next(yieldTo(&TestCoroutineTimeoutLatency::onReady));
+  }
+
+  Action onReady() {
+    auto latency = oatpp::Environment::getMicroTickCount() - m_timePoint;
+    auto max = m_maxLatency->load();
+    while(latency > max && !m_maxLatency->compare_exchange_weak(max, latency)) {}
+    return finish();
+  }
+
+};
+
 }
 
 void ConditionVariableTest::onRun() {
@@ -228,6 +260,28 @@ void ConditionVariableTest::onRun() {
 
   }
 
+  {
+
+    std::atomic<v_int64> maxLatency(0);
+
+    oatpp::async::Executor executor;
+    oatpp::async::Lock lock;
+    oatpp::async::ConditionVariable cv;
+
+    for (v_int32 iter = 0; iter < 20; iter++) {
+      executor.execute<TestCoroutineTimeoutLatency>(&lock, &cv, &maxLatency);
+    }
+
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+
+    /* latency depends on the machine load - only check that timed-out coroutines are not left behind */
+    OATPP_LOGD("TIMEOUT-LATENCY", "max latency=%ld us", maxLatency.load())
+    OATPP_ASSERT(maxLatency.load() < 1000 * 1000)
+
+  }
+
   finished = true;
   timeoutThread.join();
 
@@ -0,0 +1,108 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ExecutorPerfTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace async {
+
+namespace {
+
+static constexpr v_int32 NUM_PROCESSORS = 4;
+static constexpr v_int32 NUM_COROUTINES = 4000;
+static constexpr v_int32 HEAVY_ITERATIONS = 2000;
+static constexpr v_int32 LIGHT_ITERATIONS = 10;
+
+class TestCoroutine : public oatpp::async::Coroutine<TestCoroutine> {
+private:
+  std::atomic<v_int64>* m_sink;
+  v_int32 m_iterations;
+  v_int32 m_counter;
+  v_int64 m_value;
+public:
+
+  TestCoroutine(std::atomic<v_int64>* sink, v_int32 iterations)
+    : m_sink(sink)
+    , m_iterations(iterations)
+    , m_counter(0)
+    , m_value(0)
+  {}
+
+  Action act() override {
+    if(m_counter < m_iterations) {
+      m_counter ++;
+      for(v_int32 i = 0; i < 100; i ++) {
+        m_value = m_value * 31 + i;
+      }
+      return repeat();
+    }
+    m_sink->fetch_add(m_value & 1);
+    return finish();
+  }
+
+};
+
+}
+
+void ExecutorPerfTest::onRun() {
+
+  std::atomic<v_int64> sink(0);
+
+  oatpp::async::Executor executor(NUM_PROCESSORS, 1, 1);
+
+  {
+    oatpp::test::PerformanceChecker checker("Skewed coroutines");
+
+    /* Executor distributes coroutines round-robin - every heavy coroutine lands on the same processor */
+    for(v_int32 i = 0; i < NUM_COROUTINES; i ++) {
+      if(i % NUM_PROCESSORS == 0) {
+        executor.execute<TestCoroutine>(&sink, HEAVY_ITERATIONS);
+      } else {
+        executor.execute<TestCoroutine>(&sink, LIGHT_ITERATIONS);
+      }
+    }
+
+    executor.waitTasksFinished();
+  }
+
+  OATPP_ASSERT(executor.getTasksCount() == 0)
+
+  v_int64 stolenTasks = 0;
+  auto stats = executor.getProcessorsStats();
+  for(size_t i = 0; i < stats.size(); i ++) {
+    OATPP_LOGD(TAG, "processor[%lu]: iterations=%ld, stolen tasks=%ld", i, stats[i].iterations, stats[i].stolenTasks)
+    stolenTasks += stats[i].stolenTasks;
+  }
+
+  OATPP_ASSERT(stolenTasks > 0)
+
+  executor.stop();
+  executor.join();
+
+}
+
+}}
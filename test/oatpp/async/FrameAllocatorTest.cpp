@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "FrameAllocatorTest.hpp"
+
+#include "oatpp/async/utils/FrameAllocator.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace async {
+
+void FrameAllocatorTest::onRun() {
+
+  typedef oatpp::async::utils::FrameAllocator FrameAllocator;
+
+#if !defined(OATPP_DISABLE_POOL_ALLOCATIONS) && !defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
+
+  {
+    OATPP_LOGI(TAG, "Frames are reused...")
+    void* frame1 = FrameAllocator::allocate(100);
+    FrameAllocator::deallocate(frame1);
+    void* frame2 = FrameAllocator::allocate(100);
+    OATPP_ASSERT(frame1 == frame2)
+    FrameAllocator::deallocate(frame2);
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Frames freed by other thread are returned to the owner...")
+
+    std::vector<void*> frames;
+
+    std::thread owner([&frames] {
+
+      for(v_int32 i = 0; i < 1000; i ++) {
+        auto frame = FrameAllocator::allocate(200);
+        std::memset(frame, 0xAB, 200);
+        frames.push_back(frame);
+      }
+
+      std::thread other([&frames] {
+        for(auto frame : frames) {
+          FrameAllocator::deallocate(frame);
+        }
+      });
+      other.join();
+
+      auto heapAllocations = FrameAllocator::getStats().heapAllocations;
+      for(size_t i = 0; i < frames.size(); i ++) {
+        frames[i] = FrameAllocator::allocate(200);
+      }
+      OATPP_ASSERT(FrameAllocator::getStats().heapAllocations == heapAllocations)
+
+    });
+    owner.join();
+
+    /* owner thread is gone - its arena is released with the last frame */
+    for(auto frame : frames) {
+      FrameAllocator::deallocate(frame);
+    }
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Big frames...")
+    auto heapAllocations = FrameAllocator::getStats().heapAllocations;
+    void* frame = FrameAllocator::allocate(100 * 1024);
+    std::memset(frame, 0xAB, 100 * 1024);
+    OATPP_ASSERT(FrameAllocator::getStats().heapAllocations == heapAllocations + 1)
+    FrameAllocator::deallocate(frame);
+    OATPP_LOGI(TAG, "OK")
+  }
+
+#else
+
+  void* frame = FrameAllocator::allocate(100);
+  FrameAllocator::deallocate(frame);
+
+#endif
+
+}
+
+}}
@@ -0,0 +1,187 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOEventWorkerPerfTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+#include "oatpp/async/worker/IOEventWorker.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#ifdef OATPP_IO_EVENT_INTERFACE_EPOLL
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace async {
+
+#ifdef OATPP_IO_EVENT_INTERFACE_EPOLL
+
+namespace {
+
+static constexpr v_int32 NUM_CONNECTIONS = 20;
+static constexpr v_int32 NUM_REQUESTS = 500;
+
+/**
+ * Keep-alive "client" - writes one byte request and waits for one byte response on the same handle.
+ */
+class ClientCoroutine : public oatpp::async::Coroutine<ClientCoroutine> {
+private:
+  v_io_handle m_handle;
+  v_int32 m_counter;
+public:
+
+  ClientCoroutine(v_io_handle handle)
+    : m_handle(handle)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == NUM_REQUESTS) {
+      return finish();
+    }
+    v_char8 byte = 'R';
+    auto res = ::write(m_handle, &byte, 1);
+    if(res != 1) {
+      return error<oatpp::async::Error>("write failed");
+    }
+    return yieldTo(&ClientCoroutine::readResponse);
+  }
+
+  Action readResponse() {
+    v_char8 byte;
+    auto res = ::read(m_handle, &byte, 1);
+    if(res == 1) {
+      m_counter ++;
+      return yieldTo(&ClientCoroutine::act);
+    }
+    if(res < 0 && errno == EAGAIN) {
+      return ioWait(m_handle, Action::IOEventType::IO_EVENT_READ);
+    }
+    return error<oatpp::async::Error>("read failed");
+  }
+
+};
+
+/**
+ * Keep-alive "server" - waits for one byte request and writes one byte response on the same handle.
+ */
+class ServerCoroutine : public oatpp::async::Coroutine<ServerCoroutine> {
+private:
+  v_io_handle m_handle;
+  v_int32 m_counter;
+public:
+
+  ServerCoroutine(v_io_handle handle)
+    : m_handle(handle)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == NUM_REQUESTS) {
+      return finish();
+    }
+    v_char8 byte;
+    auto res = ::read(m_handle, &byte, 1);
+    if(res == 1) {
+      return yieldTo(&ServerCoroutine::writeResponse);
+    }
+    if(res < 0 && errno == EAGAIN) {
+      return ioWait(m_handle, Action::IOEventType::IO_EVENT_READ);
+    }
+    return error<oatpp::async::Error>("read failed");
+  }
+
+  Action writeResponse() {
+    v_char8 byte = 'A';
+    auto res = ::write(m_handle, &byte, 1);
+    if(res != 1) {
+      return error<oatpp::async::Error>("write failed");
+    }
+    m_counter ++;
+    return yieldTo(&ServerCoroutine::act);
+  }
+
+};
+
+}
+
+void IOEventWorkerPerfTest::onRun() {
+
+  std::vector<int> handles;
+
+  oatpp::async::Executor executor(1, 1, 1);
+
+  for(v_int32 i = 0; i < NUM_CONNECTIONS; i ++) {
+    int pair[2];
+    auto res = ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair);
+    OATPP_ASSERT(res == 0)
+    handles.push_back(pair[0]);
+    handles.push_back(pair[1]);
+  }
+
+  auto callsBefore = oatpp::async::worker::IOEventWorker::getEventControlCallsCount();
+  auto syscallsBefore = oatpp::async::worker::IOEventWorker::getSyscallsCount();
+
+  {
+    oatpp::test::PerformanceChecker checker("Keep-alive ping-pong");
+    for(v_int32 i = 0; i < NUM_CONNECTIONS; i ++) {
+      executor.execute<ServerCoroutine>(handles[static_cast<size_t>(i * 2 + 1)]);
+      executor.execute<ClientCoroutine>(handles[static_cast<size_t>(i * 2)]);
+    }
+    executor.waitTasksFinished();
+  }
+
+  auto calls = oatpp::async::worker::IOEventWorker::getEventControlCallsCount() - callsBefore;
+  auto syscalls = oatpp::async::worker::IOEventWorker::getSyscallsCount() - syscallsBefore;
+  auto requests = NUM_CONNECTIONS * NUM_REQUESTS;
+
+  OATPP_LOGD(TAG, "requests=%d, epoll_ctl calls=%ld, calls per request=%.2f",
+             requests, calls, static_cast<v_float64>(calls) / requests)
+  OATPP_LOGD(TAG, "requests=%d, syscalls=%ld, syscalls per request=%.2f",
+             requests, syscalls, static_cast<v_float64>(syscalls) / requests)
+
+  /* each request parks server and client at most once - one re-arm call per park, two for the first park on a handle */
+  OATPP_ASSERT(calls <= requests * 2 + NUM_CONNECTIONS * 4)
+  /* epoll_wait and wakeup trigger calls are shared by all parks ready at once */
+  OATPP_ASSERT(syscalls <= requests * 4)
+
+  executor.stop();
+  executor.join();
+
+  for(auto handle : handles) {
+    ::close(handle);
+  }
+
+}
+
+#else
+
+void IOEventWorkerPerfTest::onRun() {
+  OATPP_LOGD(TAG, "epoll is not available. Skipping...")
+}
+
+#endif
+
+}}
@@ -0,0 +1,282 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "IOUringWorkerTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+#include "oatpp/async/worker/IOUringWorker.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#ifdef OATPP_IO_URING_INTERFACE
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <thread>
+
+namespace oatpp { namespace async {
+
+#ifdef OATPP_IO_URING_INTERFACE
+
+namespace {
+
+static constexpr v_int32 NUM_CONNECTIONS = 20;
+static constexpr v_int32 NUM_REQUESTS = 500;
+
+/**
+ * Keep-alive "client" - writes one byte request and waits for one byte response on the same handle.
+ */
+class ClientCoroutine : public oatpp::async::Coroutine<ClientCoroutine> {
+private:
+  v_io_handle m_handle;
+  v_int32 m_counter;
+public:
+
+  ClientCoroutine(v_io_handle handle)
+    : m_handle(handle)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == NUM_REQUESTS) {
+      return finish();
+    }
+    v_char8 byte = 'R';
+    auto res = ::write(m_handle, &byte, 1);
+    if(res != 1) {
+      return error<oatpp::async::Error>("write failed");
+    }
+    return yieldTo(&ClientCoroutine::readResponse);
+  }
+
+  Action readResponse() {
+    v_char8 byte;
+    auto res = ::read(m_handle, &byte, 1);
+    if(res == 1) {
+      m_counter ++;
+      return yieldTo(&ClientCoroutine::act);
+    }
+    if(res < 0 && errno == EAGAIN) {
+      return ioWait(m_handle, Action::IOEventType::IO_EVENT_READ);
+    }
+    return error<oatpp::async::Error>("read failed");
+  }
+
+};
+
+/**
+ * Keep-alive "server" - waits for one byte request and writes one byte response on the same handle.
+ */
+class ServerCoroutine : public oatpp::async::Coroutine<ServerCoroutine> {
+private:
+  v_io_handle m_handle;
+  v_int32 m_counter;
+public:
+
+  ServerCoroutine(v_io_handle handle)
+    : m_handle(handle)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == NUM_REQUESTS) {
+      return finish();
+    }
+    v_char8 byte;
+    auto res = ::read(m_handle, &byte, 1);
+    if(res == 1) {
+      return yieldTo(&ServerCoroutine::writeResponse);
+    }
+    if(res < 0 && errno == EAGAIN) {
+      return ioWait(m_handle, Action::IOEventType::IO_EVENT_READ);
+    }
+    return error<oatpp::async::Error>("read failed");
+  }
+
+  Action writeResponse() {
+    v_char8 byte = 'A';
+    auto res = ::write(m_handle, &byte, 1);
+    if(res != 1) {
+      return error<oatpp::async::Error>("write failed");
+    }
+    m_counter ++;
+    return yieldTo(&ServerCoroutine::act);
+  }
+
+};
+
+/**
+ * Waits until the handle is readable - finishes on data or on end of stream.
+ */
+class ParkedCoroutine : public oatpp::async::Coroutine<ParkedCoroutine> {
+public:
+  static std::atomic<v_int32> DESTROYED_COUNT;
+private:
+  v_io_handle m_handle;
+public:
+
+  ParkedCoroutine(v_io_handle handle)
+    : m_handle(handle)
+  {}
+
+  ~ParkedCoroutine() override {
+    DESTROYED_COUNT ++;
+  }
+
+  Action act() override {
+    v_char8 byte;
+    auto res = ::read(m_handle, &byte, 1);
+    if(res < 0 && errno == EAGAIN) {
+      return ioWait(m_handle, Action::IOEventType::IO_EVENT_READ);
+    }
+    return finish();
+  }
+
+};
+
+std::atomic<v_int32> ParkedCoroutine::DESTROYED_COUNT(0);
+
+/* more than the submission queue of one worker can take */
+static constexpr v_int32 NUM_PARKED = 1500;
+
+void setNonBlocking(v_io_handle handle) {
+  auto flags = fcntl(handle, F_GETFL);
+  OATPP_ASSERT(fcntl(handle, F_SETFL, flags | O_NONBLOCK) == 0)
+}
+
+/**
+ * Create connected pair of loopback TCP sockets.
+ */
+void createLoopbackPair(v_io_handle listener, const sockaddr_in& address, v_io_handle& client, v_io_handle& server) {
+  client = ::socket(AF_INET, SOCK_STREAM, 0);
+  OATPP_ASSERT(client >= 0)
+  OATPP_ASSERT(::connect(client, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+  server = ::accept(listener, nullptr, nullptr);
+  OATPP_ASSERT(server >= 0)
+  setNonBlocking(client);
+  setNonBlocking(server);
+}
+
+}
+
+void IOUringWorkerTest::onRun() {
+
+  if(!oatpp::async::worker::IOUringWorker::isSupported()) {
+    OATPP_LOGD(TAG, "io_uring is not supported by the kernel. Skipping...")
+    return;
+  }
+
+  v_io_handle listener = ::socket(AF_INET, SOCK_STREAM, 0);
+  OATPP_ASSERT(listener >= 0)
+
+  sockaddr_in address {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  OATPP_ASSERT(::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0)
+  OATPP_ASSERT(::listen(listener, NUM_CONNECTIONS) == 0)
+  socklen_t addressSize = sizeof(address);
+  OATPP_ASSERT(::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &addressSize) == 0)
+
+  std::vector<v_io_handle> handles;
+  for(v_int32 i = 0; i < NUM_CONNECTIONS; i ++) {
+    v_io_handle client;
+    v_io_handle server;
+    createLoopbackPair(listener, address, client, server);
+    handles.push_back(client);
+    handles.push_back(server);
+  }
+
+  oatpp::async::Executor executor(1, 1, 1, oatpp::async::Executor::IO_WORKER_TYPE_URING);
+
+  auto callsBefore = oatpp::async::worker::IOUringWorker::getEnterCallsCount();
+
+  {
+    oatpp::test::PerformanceChecker checker("Keep-alive ping-pong (io_uring)");
+    for(v_int32 i = 0; i < NUM_CONNECTIONS; i ++) {
+      executor.execute<ServerCoroutine>(handles[static_cast<size_t>(i * 2 + 1)]);
+      executor.execute<ClientCoroutine>(handles[static_cast<size_t>(i * 2)]);
+    }
+    executor.waitTasksFinished();
+  }
+
+  auto calls = oatpp::async::worker::IOUringWorker::getEnterCallsCount() - callsBefore;
+  auto requests = NUM_CONNECTIONS * NUM_REQUESTS;
+
+  OATPP_LOGD(TAG, "requests=%d, io_uring_enter calls=%ld, calls per request=%.2f",
+             requests, calls, static_cast<v_float64>(calls) / requests)
+
+  /* submissions are batched with the wait - no more than one enter call per park */
+  OATPP_ASSERT(calls <= requests * 2 + NUM_CONNECTIONS * 2)
+
+  executor.stop();
+  executor.join();
+
+  {
+    OATPP_LOGD(TAG, "Park more coroutines than the submission queue size...")
+    oatpp::async::Executor parkExecutor(1, 1, 1, oatpp::async::Executor::IO_WORKER_TYPE_URING);
+    for(v_int32 i = 0; i < NUM_PARKED; i ++) {
+      parkExecutor.execute<ParkedCoroutine>(handles[0]);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ::shutdown(handles[1], SHUT_WR); // end of stream - wakes all parked coroutines
+    parkExecutor.waitTasksFinished();
+    OATPP_ASSERT(ParkedCoroutine::DESTROYED_COUNT == NUM_PARKED)
+    parkExecutor.stop();
+    parkExecutor.join();
+  }
+
+  {
+    OATPP_LOGD(TAG, "Destroy worker with coroutines parked in the ring...")
+    oatpp::async::Executor parkExecutor(1, 1, 1, oatpp::async::Executor::IO_WORKER_TYPE_URING);
+    for(v_int32 i = 0; i < NUM_PARKED; i ++) {
+      parkExecutor.execute<ParkedCoroutine>(handles[2]);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    parkExecutor.stop();
+    parkExecutor.join();
+  }
+  OATPP_ASSERT(ParkedCoroutine::DESTROYED_COUNT == NUM_PARKED * 2)
+
+  for(auto handle : handles) {
+    ::close(handle);
+  }
+  ::close(listener);
+
+}
+
+#else
+
+void IOUringWorkerTest::onRun() {
+  OATPP_LOGD(TAG, "io_uring is not available. Skipping...")
+}
+
+#endif
+
+}}
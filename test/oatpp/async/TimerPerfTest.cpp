@@ -0,0 +1,106 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TimerPerfTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace async {
+
+namespace {
+
+static constexpr v_int32 NUM_TIMERS = 100000;
+static constexpr v_int32 NUM_REPEATS = 3;
+static constexpr v_int64 MAX_DELAY_MICROSECONDS = 200 * 1000;
+
+class TimerCoroutine : public oatpp::async::Coroutine<TimerCoroutine> {
+private:
+  std::atomic<v_int64>* m_fired;
+  std::atomic<v_int64>* m_maxLateness;
+  v_int64 m_delay;
+  v_int64 m_timePoint;
+  v_int32 m_counter;
+public:
+
+  TimerCoroutine(std::atomic<v_int64>* fired, std::atomic<v_int64>* maxLateness, v_int64 delay)
+    : m_fired(fired)
+    , m_maxLateness(maxLateness)
+    , m_delay(delay)
+    , m_timePoint(0)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+
+    if(m_counter > 0) {
+      auto lateness = oatpp::Environment::getMicroTickCount() - m_timePoint;
+      auto max = m_maxLateness->load();
+      while(lateness > max && !m_maxLateness->compare_exchange_weak(max, lateness)) {}
+      m_fired->fetch_add(1);
+    }
+
+    if(m_counter < NUM_REPEATS) {
+      m_counter ++;
+      m_timePoint = oatpp::Environment::getMicroTickCount() + m_delay;
+      return waitRepeat(std::chrono::microseconds(m_delay));
+    }
+
+    return finish();
+
+  }
+
+};
+
+}
+
+void TimerPerfTest::onRun() {
+
+  std::atomic<v_int64> fired(0);
+  std::atomic<v_int64> maxLateness(0);
+
+  oatpp::async::Executor executor(1, 1, 1);
+
+  {
+    oatpp::test::PerformanceChecker checker("Timers");
+
+    for(v_int32 i = 0; i < NUM_TIMERS; i ++) {
+      executor.execute<TimerCoroutine>(&fired, &maxLateness, (i * 7919) % MAX_DELAY_MICROSECONDS + 1);
+    }
+
+    executor.waitTasksFinished();
+  }
+
+  OATPP_LOGD(TAG, "timers fired=%ld, max lateness=%ld us", fired.load(), maxLateness.load())
+
+  OATPP_ASSERT(fired.load() == NUM_TIMERS * NUM_REPEATS)
+  OATPP_ASSERT(executor.getTasksCount() == 0)
+
+  executor.stop();
+  executor.join();
+
+}
+
+}}
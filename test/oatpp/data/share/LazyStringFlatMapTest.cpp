@@ -0,0 +1,156 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "LazyStringFlatMapTest.hpp"
+
+#include "oatpp/data/share/LazyStringFlatMap.hpp"
+#include "oatpp/data/share/LazyStringMap.hpp"
+#include "oatpp-test/Checker.hpp"
+#include "oatpp/Types.hpp"
+
+namespace oatpp { namespace data { namespace share {
+
+void LazyStringFlatMapTest::onRun() {
+
+  const char* text = "Hello World!";
+
+  {
+    OATPP_LOGI(TAG, "Basic operations...")
+
+    LazyStringFlatMultimap<StringKeyLabelCI> map;
+
+    map.put("key1", StringKeyLabel(nullptr, text, 5));
+    map.put("key2", StringKeyLabel(nullptr, text + 6, 6));
+
+    oatpp::String s1 = map.get("key1");
+    oatpp::String s2 = map.get("KEY2");
+
+    OATPP_ASSERT(s1 == "Hello")
+    OATPP_ASSERT(s2 == "World!")
+    OATPP_ASSERT(s1.get() == map.get("Key1").get())
+    OATPP_ASSERT(map.get("key3") == nullptr)
+
+    auto s01 = map.getAsMemoryLabel_Unsafe<StringKeyLabel>("key1");
+    OATPP_ASSERT(s01 == "Hello")
+
+    OATPP_ASSERT(map.putIfNotExists("KEY1", StringKeyLabel(nullptr, text + 6, 6)) == false)
+    OATPP_ASSERT(map.putIfNotExists("key3", StringKeyLabel(nullptr, text + 6, 6)) == true)
+    OATPP_ASSERT(map.getSize() == 3)
+
+    map.put("key1", StringKeyLabel(nullptr, text, 2));
+    OATPP_ASSERT(map.getSize() == 4)
+    OATPP_ASSERT(map.get("key1") == "Hello")
+
+    OATPP_ASSERT(map.putOrReplace("Key1", StringKeyLabel(nullptr, text, 1)) == true)
+    OATPP_ASSERT(map.getSize() == 3)
+    OATPP_ASSERT(map.get("key1") == "H")
+    OATPP_ASSERT(map.putOrReplace("key4", StringKeyLabel(nullptr, text, 1)) == false)
+
+    const char* order[] = {"key2", "key3", "Key1", "key4"};
+    v_int32 i = 0;
+    for(auto& pair : map.getAll()) {
+      OATPP_ASSERT(pair.first == order[i])
+      OATPP_ASSERT(pair.first.getMemoryHandle() && pair.second.getMemoryHandle())
+      i ++;
+    }
+    OATPP_ASSERT(i == 4)
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Inline capacity overflow...")
+
+    LazyStringFlatMultimap<StringKeyLabelCI, StringKeyLabel, 4> map;
+    std::vector<oatpp::String> keys;
+
+    for(v_int32 i = 0; i < 20; i ++) {
+      keys.push_back(oatpp::String("key-" + std::to_string(i)));
+      map.put(keys.back(), keys.back());
+    }
+
+    OATPP_ASSERT(map.getSize() == 20)
+    for(auto& key : keys) {
+      OATPP_ASSERT(map.get(key) == key)
+    }
+
+    map.putOrReplace("KEY-0", "zero");
+    OATPP_ASSERT(map.getSize() == 20)
+    OATPP_ASSERT(map.get("key-0") == "zero")
+
+    auto copy = map;
+    auto moved = std::move(map);
+
+    OATPP_ASSERT(map.getSize() == 0)
+    OATPP_ASSERT(copy.getSize() == 20 && moved.getSize() == 20)
+    OATPP_ASSERT(copy.get("key-19") == "key-19" && moved.get("key-19") == "key-19")
+
+    LazyStringFlatMultimap<StringKeyLabelCI, StringKeyLabel, 4> small;
+    small.put("a", "b");
+    moved = std::move(small);
+    OATPP_ASSERT(moved.getSize() == 1 && moved.get("A") == "b")
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    const v_int32 iterations = 200000;
+    const char* names[] = {"Host", "User-Agent", "Accept", "Accept-Encoding", "Accept-Language", "Connection", "Cookie", "Content-Length"};
+
+    v_int64 multimapTime;
+    v_int64 flatTime;
+
+    {
+      oatpp::test::PerformanceChecker checker("LazyStringMultimap");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        LazyStringMultimap<StringKeyLabelCI> map;
+        for(auto name : names) {
+          map.put_LockFree(StringKeyLabelCI(nullptr, name, static_cast<v_buff_size>(std::strlen(name))), StringKeyLabel(nullptr, text, 5));
+        }
+        OATPP_ASSERT(map.getAsMemoryLabel_Unsafe<StringKeyLabel>("content-length").getSize() == 5)
+        OATPP_ASSERT(map.getAsMemoryLabel_Unsafe<StringKeyLabel>("connection").getSize() == 5)
+      }
+      multimapTime = checker.getElapsedTicks();
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("LazyStringFlatMultimap");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        LazyStringFlatMultimap<StringKeyLabelCI> map;
+        for(auto name : names) {
+          map.put_LockFree(StringKeyLabelCI(nullptr, name, static_cast<v_buff_size>(std::strlen(name))), StringKeyLabel(nullptr, text, 5));
+        }
+        OATPP_ASSERT(map.getAsMemoryLabel_Unsafe<StringKeyLabel>("content-length").getSize() == 5)
+        OATPP_ASSERT(map.getAsMemoryLabel_Unsafe<StringKeyLabel>("connection").getSize() == 5)
+      }
+      flatTime = checker.getElapsedTicks();
+    }
+
+    OATPP_LOGD(TAG, "per map: multimap=%ldns, flat=%ldns", multimapTime * 1000 / iterations, flatTime * 1000 / iterations)
+  }
+
+}
+
+}}}
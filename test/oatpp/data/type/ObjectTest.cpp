@@ -234,6 +234,34 @@ void ObjectTest::onRun() {
       OATPP_ASSERT(it->second->info.description == "some field with a qualified name")
     }
 
+    {
+      auto props = dispatcher->getProperties();
+      OATPP_ASSERT(props->getList().size() == 2)
+      OATPP_ASSERT(props->find("id") == propsMap.find("id")->second)
+      OATPP_ASSERT(props->find("field-a") == propsMap.find("field-a")->second)
+      OATPP_ASSERT(props->find("field-a-suffix", 7) == propsMap.find("field-a")->second)
+      OATPP_ASSERT(props->find("field-b") == nullptr)
+      OATPP_ASSERT(props->find("field", 5) == nullptr)
+      OATPP_ASSERT(props->find("", 0) == nullptr)
+    }
+
+    {
+      oatpp::data::type::BaseObject::Properties props;
+      oatpp::data::type::BaseObject::Property id(0, "id", nullptr);
+      oatpp::data::type::BaseObject::Property fieldA(8, "field-a", nullptr);
+      props.pushBack(&id);
+      props.pushBack(&fieldA);
+
+      /* not indexed yet */
+      OATPP_ASSERT(props.find("field-a-suffix", 7) == &fieldA)
+      OATPP_ASSERT(props.find("field", 5) == nullptr)
+
+      props.buildIndex();
+      OATPP_ASSERT(props.find("id") == &id)
+      OATPP_ASSERT(props.find("field-a-suffix", 7) == &fieldA)
+      OATPP_ASSERT(props.find("field", 5) == nullptr)
+    }
+
     OATPP_LOGI(TAG, "OK")
   }
 
@@ -572,6 +600,36 @@ void ObjectTest::onRun() {
     OATPP_LOGI(TAG, "OK")
   }
 
+  {
+    OATPP_LOGI(TAG, "Test 19...")
+
+    oatpp::json::ObjectMapper mapper;
+    mapper.serializerConfig().bypassTree = true;
+    mapper.deserializerConfig().bypassTree = true;
+
+    auto dto = PolymorphicDto1::createShared();
+
+    dto->type = "B";
+    dto->polymorph = DtoTypeB::createShared();
+
+    auto json = mapper.writeToString(dto);
+    OATPP_LOGD(TAG, "json0='%s'", json->c_str())
+
+    /* polymorph goes before the type field - its value can be mapped only when the whole object is parsed */
+    auto dtoClone = mapper.readFromString<oatpp::Object<PolymorphicDto1>>(R"({"polymorph":{"fieldB":"type-B"},"type":"B"})");
+
+    auto jsonClone = mapper.writeToString(dtoClone);
+    OATPP_LOGD(TAG, "json1='%s'", jsonClone->c_str())
+
+    OATPP_ASSERT(json == jsonClone)
+
+    auto polymorphClone = dtoClone->polymorph.retrieve<oatpp::Object<DtoTypeB>>();
+
+    OATPP_ASSERT(polymorphClone->fieldB == "type-B")
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
 }
 
 }}}
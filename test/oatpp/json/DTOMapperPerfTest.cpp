@@ -74,17 +74,32 @@ void DTOMapperPerfTest::onRun() {
   v_int32 numIterations = 1000000;
 
   oatpp::json::ObjectMapper mapper;
+
+  oatpp::json::ObjectMapper directMapper;
+  directMapper.serializerConfig().bypassTree = true;
+  directMapper.deserializerConfig().bypassTree = true;
   
   auto test1 = Test1::createTestInstance();
   auto test1_Text = mapper.writeToString(test1);
   OATPP_LOGV(TAG, "json='%s'", test1_Text->c_str())
 
+  auto test1_DirectText = directMapper.writeToString(test1);
+  OATPP_LOGV(TAG, "direct json='%s'", test1_DirectText->c_str())
+  OATPP_ASSERT(test1_Text == test1_DirectText)
+
   {
     oatpp::test::PerformanceChecker checker("Serializer");
     for(v_int32 i = 0; i < numIterations; i ++) {
       mapper.writeToString(test1);
     }
   }
+
+  {
+    oatpp::test::PerformanceChecker checker("Serializer (bypass Tree)");
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      directMapper.writeToString(test1);
+    }
+  }
   
   {
     oatpp::test::PerformanceChecker checker("Deserializer");
@@ -95,6 +110,15 @@ void DTOMapperPerfTest::onRun() {
     }
   }
 
+  {
+    oatpp::test::PerformanceChecker checker("Deserializer (bypass Tree)");
+    oatpp::utils::parser::Caret caret(test1_Text);
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      caret.setPosition(0);
+      directMapper.readFromCaret<oatpp::Object<Test1>>(caret);
+    }
+  }
+
 }
   
 }}
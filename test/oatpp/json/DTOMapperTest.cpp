@@ -167,6 +167,11 @@ void DTOMapperTest::onRun(){
   oatpp::json::ObjectMapper mapper;
   mapper.serializerConfig().json.useBeautifier = true;
 
+  oatpp::json::ObjectMapper directMapper;
+  directMapper.serializerConfig().json.useBeautifier = true;
+  directMapper.serializerConfig().bypassTree = true;
+  directMapper.deserializerConfig().bypassTree = true;
+
   {
     auto test1 = Test::createShared();
 
@@ -271,6 +276,8 @@ void DTOMapperTest::onRun(){
 
     OATPP_LOGV(TAG, "json='%s'", result->c_str())
 
+    OATPP_ASSERT(directMapper.writeToString(test1) == result)
+
     OATPP_LOGV(TAG, "...")
     OATPP_LOGV(TAG, "...")
     OATPP_LOGV(TAG, "...")
@@ -323,6 +330,10 @@ void DTOMapperTest::onRun(){
     result = mapper.writeToString(obj1);
 
     OATPP_LOGV(TAG, "json='%s'", result->c_str())
+
+    caret.setPosition(0);
+    auto directObj1 = directMapper.readFromCaret<oatpp::Object<Test>>(caret);
+    OATPP_ASSERT(mapper.writeToString(directObj1) == result)
   }
 
   {
@@ -334,6 +345,13 @@ void DTOMapperTest::onRun(){
       OATPP_LOGV(TAG, "Test2::field_string is required!")
     }
     OATPP_ASSERT(result == nullptr)
+
+    try {
+      result = directMapper.writeToString(test2);
+    } catch(std::runtime_error&) {
+      OATPP_LOGV(TAG, "Test2::field_string is required! (bypass Tree)")
+    }
+    OATPP_ASSERT(result == nullptr)
   }
 
   {
@@ -391,11 +409,16 @@ void DTOMapperTest::onRun(){
     auto json = mapper.writeToString(obj2);
     OATPP_LOGV(TAG, "any json='%s'", json->c_str())
 
+    OATPP_ASSERT(directMapper.writeToString(obj2) == json)
+
     auto deserializedAny = mapper.readFromString<oatpp::Fields<oatpp::Any>>(json);
 
     auto json2 = mapper.writeToString(deserializedAny);
     OATPP_LOGV(TAG, "any json='%s'", json2->c_str())
 
+    auto directDeserializedAny = directMapper.readFromString<oatpp::Fields<oatpp::Any>>(json);
+    OATPP_ASSERT(mapper.writeToString(directDeserializedAny) == json2)
+
   }
 
 }
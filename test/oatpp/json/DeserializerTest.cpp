@@ -322,6 +322,76 @@ void DeserializerTest::onRun(){
     OATPP_ASSERT(dto->any.retrieve<Int64>() == -1234567890)
   }
 
+  OATPP_LOGD(TAG, "Direct deserializer (bypassTree)")
+  {
+
+    oatpp::json::ObjectMapper directMapper;
+    directMapper.deserializerConfig().bypassTree = true;
+
+    const char* const texts[] = {
+      "{}",
+      "{\n\r\t\f\"strF\"\n\r\t\f:\n\r\t\f\"value1\"\n\r\t\f}",
+      R"({"strF":"value1","unknown":{"a":[1,2,{"b":null}]}})"
+    };
+    for(auto text : texts) {
+      auto treeObj = mapper.readFromString<oatpp::Object<Test1>>(text);
+      auto directObj = directMapper.readFromString<oatpp::Object<Test1>>(text);
+      OATPP_ASSERT(directObj)
+      OATPP_ASSERT(directObj->strF == treeObj->strF)
+    }
+
+    auto directObj2 = directMapper.readFromString<oatpp::Object<Test2>>("{\"int32F\":    -32}");
+    OATPP_ASSERT(directObj2)
+    OATPP_ASSERT(directObj2->int32F == -32)
+
+    auto directObj3 = directMapper.readFromString<oatpp::Object<Test3>>("{\"float32F\": -1.32E1 }");
+    OATPP_ASSERT(directObj3)
+    OATPP_ASSERT(fabsf(directObj3->float32F + 13.2f) < 0.0001f)
+
+    auto directList = directMapper.readFromString<oatpp::List<oatpp::Int32>>("[1, 2, 3]");
+    OATPP_ASSERT(directList)
+    OATPP_ASSERT(directList->size() == 3)
+    OATPP_ASSERT(directList[2] == 3)
+
+    auto directObj4 = directMapper.readFromString<oatpp::Object<Test4>>("{\"object\": {\n\r\t}, \"list\": [\n\r\t], \"map\": {\n\r\t}}");
+    OATPP_ASSERT(directObj4)
+    OATPP_ASSERT(directObj4->object)
+    OATPP_ASSERT(directObj4->list)
+    OATPP_ASSERT(directObj4->list->size() == 0)
+    OATPP_ASSERT(directObj4->map->size() == 0)
+
+    bool thrown = false;
+    try {
+      directMapper.readFromString<oatpp::Object<Test5>>(R"({"strF":null})");
+    } catch (std::runtime_error& e) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown)
+
+    thrown = false;
+    try {
+      directMapper.readFromString<oatpp::Object<Test7>>(R"({"strF":"value1", "child":{"name":null}})");
+    } catch (std::runtime_error& e) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown)
+
+    auto directObj8 = directMapper.readFromString<oatpp::Object<Test8>>(R"({"strF":"value1", "child":{"name":null}})");
+    OATPP_ASSERT(directObj8)
+    OATPP_ASSERT(directObj8->child)
+
+    auto directAnyDto = directMapper.readFromString<oatpp::Object<AnyDto>>(R"({"any":9223372036854775807,"another":1.1})");
+    OATPP_ASSERT(directAnyDto)
+    OATPP_ASSERT(directAnyDto->any.getStoredType() == Int64::Class::getType())
+    OATPP_ASSERT(directAnyDto->any.retrieve<Int64>() == 9223372036854775807)
+
+    directAnyDto = directMapper.readFromString<oatpp::Object<AnyDto>>(R"({"any":-1.2345e30,"another":1.1})");
+    OATPP_ASSERT(directAnyDto)
+    OATPP_ASSERT(directAnyDto->any.getStoredType() == Float64::Class::getType())
+    OATPP_ASSERT(fabs(directAnyDto->any.retrieve<Float64>() - -1.2345e30) < std::numeric_limits<double>::epsilon())
+
+  }
+
 }
   
 }}
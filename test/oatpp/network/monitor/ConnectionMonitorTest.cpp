@@ -32,17 +32,157 @@
 
 #include "oatpp/network/monitor/ConnectionMonitor.hpp"
 #include "oatpp/network/monitor/ConnectionMaxAgeChecker.hpp"
+#include "oatpp/network/monitor/ConnectionInactivityChecker.hpp"
 
 #include "oatpp/network/Server.hpp"
 #include "oatpp/network/tcp/client/ConnectionProvider.hpp"
 #include "oatpp/network/tcp/server/ConnectionProvider.hpp"
 
+#include "oatpp-test/Checker.hpp"
+
 #include <thread>
+#include <atomic>
 
 namespace oatpp { namespace test { namespace network { namespace monitor {
 
 namespace {
 
+class NullStream : public oatpp::data::stream::IOStream, public oatpp::base::Countable {
+private:
+  oatpp::data::stream::DefaultInitializedContext m_context {oatpp::data::stream::StreamType::STREAM_INFINITE};
+public:
+
+  v_io_size write(const void *buff, v_buff_size count, async::Action& actions) override {
+    return count;
+  }
+
+  v_io_size read(void *buff, v_buff_size count, async::Action& action) override {
+    return count;
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {}
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  oatpp::data::stream::Context& getOutputStreamContext() override {
+    return m_context;
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {}
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  oatpp::data::stream::Context& getInputStreamContext() override {
+    return m_context;
+  }
+
+};
+
+class NullStreamProvider : public oatpp::network::ConnectionProvider {
+private:
+
+  class Invalidator : public oatpp::provider::Invalidator<oatpp::data::stream::IOStream> {
+  public:
+
+    std::atomic<v_int64> invalidations {0};
+
+    void invalidate(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) override {
+      (void)connection;
+      invalidations ++;
+    }
+
+  };
+
+private:
+  std::shared_ptr<Invalidator> m_invalidator = std::make_shared<Invalidator>();
+public:
+
+  v_int64 getInvalidationsCount() {
+    return m_invalidator->invalidations;
+  }
+
+  oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream> get() override {
+    return oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>(std::make_shared<NullStream>(), m_invalidator);
+  }
+
+  oatpp::async::CoroutineStarterForResult<const oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>&> getAsync() override {
+    throw std::runtime_error("Not implemented");
+  }
+
+  void stop() override {}
+
+};
+
+class ReadsCountCollector : public oatpp::network::monitor::StatCollector {
+public:
+
+  oatpp::String metricName() override {
+    return "test::reads";
+  }
+
+  void* createMetricData() override {
+    return new std::atomic<v_int64>(0);
+  }
+
+  void deleteMetricData(void* metricData) override {
+    delete static_cast<std::atomic<v_int64>*>(metricData);
+  }
+
+  void onRead(void* metricData, v_io_size readResult, v_int64 timestamp) override {
+    static_cast<std::atomic<v_int64>*>(metricData)->fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void onWrite(void* metricData, v_io_size writeResult, v_int64 timestamp) override {}
+
+};
+
+class ObservingChecker : public oatpp::network::monitor::MetricsChecker {
+public:
+
+  std::atomic<v_int64> maxTotalRead {0};
+  std::atomic<v_int64> maxTotalWrite {0};
+  std::atomic<v_int64> maxReads {0};
+
+  std::vector<oatpp::String> getMetricsList() override {
+    return {"test::reads"};
+  }
+
+  std::shared_ptr<oatpp::network::monitor::StatCollector> createStatCollector(const oatpp::String& metricName) override {
+    return std::make_shared<ReadsCountCollector>();
+  }
+
+  bool check(const oatpp::network::monitor::ConnectionStats& stats, v_int64 currMicroTime) override {
+    maxTotalRead = std::max<v_int64>(maxTotalRead, stats.totalRead);
+    maxTotalWrite = std::max<v_int64>(maxTotalWrite, stats.totalWrite);
+    auto it = stats.metricsData.find("test::reads");
+    if(it != stats.metricsData.end()) {
+      maxReads = std::max<v_int64>(maxReads, static_cast<std::atomic<v_int64>*>(it->second)->load());
+    }
+    return true;
+  }
+
+};
+
+class CountingInactivityChecker : public oatpp::network::monitor::ConnectionInactivityChecker {
+public:
+
+  std::atomic<v_int64> checks {0};
+
+  CountingInactivityChecker(const std::chrono::duration<v_int64, std::micro>& timeout)
+    : ConnectionInactivityChecker(timeout, timeout)
+  {}
+
+  bool check(const oatpp::network::monitor::ConnectionStats& stats, v_int64 currMicroTime) override {
+    checks ++;
+    return ConnectionInactivityChecker::check(stats, currMicroTime);
+  }
+
+};
+
 class ReadCallback : public oatpp::data::stream::ReadCallback {
 public:
 
@@ -215,6 +355,89 @@ void runAsyncClient() {
 
 void ConnectionMonitorTest::onRun() {
 
+  {
+    OATPP_LOGD(TAG, "run concurrent accounting test")
+
+    const v_int32 numThreads = 4;
+    const v_int64 iterations = 200000;
+    const v_buff_size chunkSize = 10;
+
+    auto monitor = std::make_shared<oatpp::network::monitor::ConnectionMonitor>(std::make_shared<NullStreamProvider>());
+    auto checker = std::make_shared<ObservingChecker>();
+    monitor->addMetricsChecker(checker);
+
+    std::vector<oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>> connections;
+    for(v_int32 i = 0; i < numThreads; i ++) {
+      connections.push_back(monitor->get());
+    }
+
+    {
+      PerformanceChecker timer("ConnectionMonitor read/write accounting");
+      std::vector<std::thread> threads;
+      for(v_int32 i = 0; i < numThreads; i ++) {
+        auto connection = connections[static_cast<size_t>(i)].object;
+        threads.emplace_back([connection, iterations, chunkSize]{
+          v_char8 buffer[16];
+          for(v_int64 j = 0; j < iterations; j ++) {
+            connection->readSimple(buffer, chunkSize);
+            connection->writeSimple(buffer, chunkSize);
+          }
+        });
+      }
+      for(auto& t : threads) {
+        t.join();
+      }
+    }
+
+    /* wait for the monitor to take a snapshot */
+    std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+
+    OATPP_ASSERT(checker->maxTotalRead == iterations * chunkSize)
+    OATPP_ASSERT(checker->maxTotalWrite == iterations * chunkSize)
+    OATPP_ASSERT(checker->maxReads == iterations)
+
+    connections.clear();
+    monitor->stop();
+  }
+
+  {
+    OATPP_LOGD(TAG, "run deadline expiry test")
+
+    const v_int32 numIdleConnections = 1000;
+
+    auto provider = std::make_shared<NullStreamProvider>();
+    auto monitor = std::make_shared<oatpp::network::monitor::ConnectionMonitor>(provider);
+    auto checker = std::make_shared<CountingInactivityChecker>(std::chrono::milliseconds(400));
+    monitor->addMetricsChecker(checker);
+
+    std::vector<oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>> connections;
+    for(v_int32 i = 0; i < numIdleConnections; i ++) {
+      connections.push_back(monitor->get());
+    }
+
+    auto active = monitor->get().object;
+    std::thread activeThread([active]{
+      v_char8 buffer[16];
+      for(v_int32 i = 0; i < 30; i ++) {
+        active->readSimple(buffer, 16);
+        active->writeSimple(buffer, 16);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      }
+    });
+    activeThread.join();
+
+    OATPP_LOGD(TAG, "checks=%ld, invalidations=%ld", checker->checks.load(), provider->getInvalidationsCount())
+
+    /* every idle connection is invalidated exactly once, the active one is never invalidated */
+    OATPP_ASSERT(provider->getInvalidationsCount() == numIdleConnections)
+    /* each idle connection is examined when added and when due - no periodic full scans */
+    OATPP_ASSERT(checker->checks < numIdleConnections * 2 + 20)
+
+    connections.clear();
+    active.reset();
+    monitor->stop();
+  }
+
   auto connectionProvider = oatpp::network::tcp::server::ConnectionProvider::createShared(
     {"localhost", 8000});
   auto monitor = std::make_shared<oatpp::network::monitor::ConnectionMonitor>(connectionProvider);
@@ -0,0 +1,237 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ConnectionProviderTest.hpp"
+
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+#include "oatpp/network/Server.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace test { namespace network { namespace tcp {
+
+namespace {
+
+class CountingConnectionHandler : public oatpp::network::ConnectionHandler {
+public:
+
+  std::atomic<v_int32> counter{0};
+
+  void handleConnection(const provider::ResourceHandle<IOStream>& connection,
+                        const std::shared_ptr<const ParameterMap>& params) override
+  {
+    (void) connection;
+    (void) params;
+    counter ++;
+  }
+
+  void stop() override {}
+
+};
+
+}
+
+void ConnectionProviderTest::onRun() {
+
+  typedef oatpp::network::tcp::server::ConnectionProvider ServerProvider;
+  typedef oatpp::network::tcp::client::ConnectionProvider ClientProvider;
+
+  auto first = ServerProvider::createShared({"127.0.0.1", 0, oatpp::network::Address::IP_4}, false, true);
+  auto port = first->getProperty(ServerProvider::PROPERTY_PORT).toString();
+  OATPP_LOGD(TAG, "port=%s", port->c_str())
+
+  bool success = false;
+  auto portValue = static_cast<v_uint16>(std::stoi(*port));
+
+#if !defined(WIN32) && !defined(_WIN32)
+  {
+    OATPP_LOGI(TAG, "Bind same port with SO_REUSEPORT...")
+    auto second = ServerProvider::createShared({"127.0.0.1", portValue, oatpp::network::Address::IP_4}, false, true);
+    OATPP_ASSERT(second->getProperty(ServerProvider::PROPERTY_PORT).toString() == port)
+
+    second->stop();
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Accept loop per listener...")
+
+    typedef oatpp::network::Server Server;
+
+    const v_int32 numListeners = 3;
+    const v_int32 numConnections = 30;
+
+    auto executor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+    auto listeners = ServerProvider::createListeners({"127.0.0.1", 0, oatpp::network::Address::IP_4}, numListeners);
+    OATPP_ASSERT(listeners.size() == static_cast<size_t>(numListeners))
+
+    auto listenersPort = listeners[0]->getProperty(ServerProvider::PROPERTY_PORT).toString();
+    OATPP_ASSERT(listenersPort != "0")
+
+    auto handler = std::make_shared<CountingConnectionHandler>();
+    std::list<std::shared_ptr<Server>> servers;
+    for(auto& listener : listeners) {
+      OATPP_ASSERT(listener->getProperty(ServerProvider::PROPERTY_PORT).toString() == listenersPort)
+      auto server = Server::createShared(listener, handler);
+      server->runAsync(executor);
+      servers.push_back(server);
+    }
+
+    auto client = ClientProvider::createShared({"127.0.0.1", static_cast<v_uint16>(std::stoi(*listenersPort)), oatpp::network::Address::IP_4});
+    std::list<provider::ResourceHandle<data::stream::IOStream>> clientConnections;
+    for(v_int32 i = 0; i < numConnections; i ++) {
+      clientConnections.push_back(client->get());
+    }
+
+    /* every connection is accepted by one of the accept loops - wait for all of them */
+    for(v_int32 i = 0; i < 1000 && handler->counter < numConnections; i ++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    OATPP_ASSERT(handler->counter == numConnections)
+
+    for(auto& server : servers) {
+      server->stop();
+    }
+    for(auto& listener : listeners) {
+      listener->stop();
+    }
+
+    executor->waitTasksFinished();
+    executor->stop();
+    executor->join();
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Stop one of two async listeners with SO_REUSEPORT...")
+
+    typedef oatpp::network::Server Server;
+
+    auto executor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+    auto listeners = ServerProvider::createListeners({"127.0.0.1", 0, oatpp::network::Address::IP_4}, 2);
+    auto listenersPort = static_cast<v_uint16>(std::stoi(*listeners[0]->getProperty(ServerProvider::PROPERTY_PORT).toString()));
+
+    auto stoppedHandler = std::make_shared<CountingConnectionHandler>();
+    auto runningHandler = std::make_shared<CountingConnectionHandler>();
+    Server stoppedServer(listeners[0], stoppedHandler);
+    Server runningServer(listeners[1], runningHandler);
+    stoppedServer.runAsync(executor);
+    runningServer.runAsync(executor);
+
+    /* let both accept loops park on their sockets */
+    for(v_int32 i = 0; i < 1000 && executor->getTasksCount() != 2; i ++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    stoppedServer.stop();
+    listeners[0]->stop();
+
+    /* the stopped accept loop exits without any connection reaching the other listener */
+    for(v_int32 i = 0; i < 1000 && executor->getTasksCount() != 1; i ++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    OATPP_ASSERT(executor->getTasksCount() == 1)
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    OATPP_ASSERT(stoppedHandler->counter == 0)
+    OATPP_ASSERT(runningHandler->counter == 0)
+
+    auto client = ClientProvider::createShared({"127.0.0.1", listenersPort, oatpp::network::Address::IP_4});
+    auto clientConnection = client->get();
+    OATPP_ASSERT(clientConnection.object)
+
+    for(v_int32 i = 0; i < 1000 && runningHandler->counter < 1; i ++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    OATPP_ASSERT(runningHandler->counter == 1)
+    OATPP_ASSERT(stoppedHandler->counter == 0)
+
+    runningServer.stop();
+    listeners[1]->stop();
+
+    executor->waitTasksFinished();
+    executor->stop();
+    executor->join();
+
+    OATPP_LOGI(TAG, "OK")
+  }
+#endif
+
+  {
+    OATPP_LOGI(TAG, "Bind same port without SO_REUSEPORT...")
+    try {
+      ServerProvider::createShared({"127.0.0.1", portValue, oatpp::network::Address::IP_4});
+    } catch (std::runtime_error&) {
+      success = true;
+    }
+    OATPP_ASSERT(success)
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  first->stop();
+
+  {
+    OATPP_LOGI(TAG, "Async accept loop...")
+
+    typedef oatpp::network::Server Server;
+
+    auto executor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+    auto serverProvider = ServerProvider::createShared({"127.0.0.1", 0, oatpp::network::Address::IP_4});
+    auto handler = std::make_shared<CountingConnectionHandler>();
+    auto asyncPort = static_cast<v_uint16>(std::stoi(*serverProvider->getProperty(ServerProvider::PROPERTY_PORT).toString()));
+
+    Server server(serverProvider, handler);
+    server.runAsync(executor);
+    OATPP_ASSERT(server.getStatus() == Server::STATUS_RUNNING)
+
+    auto client = ClientProvider::createShared({"127.0.0.1", asyncPort, oatpp::network::Address::IP_4});
+
+    std::list<provider::ResourceHandle<data::stream::IOStream>> clientConnections;
+    for(v_int32 i = 0; i < 20; i ++) {
+      clientConnections.push_back(client->get());
+    }
+
+    for(v_int32 i = 0; i < 100 && handler->counter < 20; i ++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    OATPP_ASSERT(handler->counter == 20)
+
+    server.stop();
+    serverProvider->stop();
+    OATPP_ASSERT(server.getStatus() == Server::STATUS_DONE)
+
+    executor->waitTasksFinished();
+    executor->stop();
+    executor->join();
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+}
+
+}}}}
@@ -0,0 +1,116 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ConnectionTest.hpp"
+
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace test { namespace network { namespace tcp {
+
+void ConnectionTest::onRun() {
+
+  typedef oatpp::network::tcp::server::ConnectionProvider ServerProvider;
+  typedef oatpp::network::tcp::client::ConnectionProvider ClientProvider;
+
+  const v_buff_size bodySize = 1024 * 1024;
+
+  oatpp::String head = "HTTP/1.1 200 OK\r\nContent-Length: 1048576\r\n\r\n";
+  std::string bodyData(static_cast<size_t>(bodySize), '\0');
+  for(v_buff_size i = 0; i < bodySize; i ++) {
+    bodyData[static_cast<size_t>(i)] = static_cast<char>('a' + i % 26);
+  }
+  oatpp::String body(std::move(bodyData));
+  oatpp::String tail = "tail";
+
+  {
+    OATPP_LOGI(TAG, "Default vectored write...")
+
+    oatpp::data::stream::BufferOutputStream stream;
+    data::buffer::InlineWriteData buffers[3] = {
+      {head->data(), static_cast<v_buff_size>(head->size())},
+      {body->data(), static_cast<v_buff_size>(body->size())},
+      {tail->data(), static_cast<v_buff_size>(tail->size())}
+    };
+
+    auto res = stream.writeExactSizeDataSimple(buffers, 3);
+    OATPP_ASSERT(res == static_cast<v_io_size>(head->size() + body->size() + tail->size()))
+    OATPP_ASSERT(stream.toString() == head + body + tail)
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Vectored write over loopback...")
+
+    auto serverProvider = ServerProvider::createShared({"127.0.0.1", 0, oatpp::network::Address::IP_4});
+    auto port = static_cast<v_uint16>(std::stoi(*serverProvider->getProperty(ServerProvider::PROPERTY_PORT).toString()));
+    auto clientProvider = ClientProvider::createShared({"127.0.0.1", port, oatpp::network::Address::IP_4});
+
+    auto clientConnection = clientProvider->get();
+    auto serverConnection = serverProvider->get();
+    OATPP_ASSERT(clientConnection.object)
+    OATPP_ASSERT(serverConnection.object)
+
+    auto expectedSize = static_cast<v_buff_size>(head->size() + body->size() + tail->size());
+
+    /* body doesn't fit socket buffers - writer blocks until the reader drains it */
+    oatpp::data::stream::BufferOutputStream received;
+    std::thread reader([&serverConnection, &received, expectedSize]{
+      v_char8 buffer[4096];
+      while(received.getCurrentPosition() < expectedSize) {
+        auto res = serverConnection.object->readSimple(buffer, 4096);
+        if(res <= 0) {
+          break;
+        }
+        received.writeSimple(buffer, res);
+      }
+    });
+
+    data::buffer::InlineWriteData buffers[3] = {
+      {head->data(), static_cast<v_buff_size>(head->size())},
+      {body->data(), static_cast<v_buff_size>(body->size())},
+      {tail->data(), static_cast<v_buff_size>(tail->size())}
+    };
+
+    auto res = clientConnection.object->writeExactSizeDataSimple(buffers, 3);
+    reader.join();
+
+    OATPP_ASSERT(res == expectedSize)
+    OATPP_ASSERT(buffers[0].bytesLeft == 0 && buffers[1].bytesLeft == 0 && buffers[2].bytesLeft == 0)
+    OATPP_ASSERT(received.toString() == head + body + tail)
+
+    serverProvider->stop();
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+}
+
+}}}}
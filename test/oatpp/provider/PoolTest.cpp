@@ -114,6 +114,35 @@ public:
 
 };
 
+/**
+ * Provider which fails to create resources - returns empty handles.
+ */
+class EmptyProvider : public oatpp::provider::Provider<Resource> {
+public:
+
+  oatpp::provider::ResourceHandle<Resource> get() override {
+    return nullptr;
+  }
+
+  async::CoroutineStarterForResult<const oatpp::provider::ResourceHandle<Resource> &> getAsync() override {
+
+    class GetCoroutine : public oatpp::async::CoroutineWithResult<GetCoroutine, const oatpp::provider::ResourceHandle<Resource>&> {
+    public:
+
+      Action act() override {
+        return _return(oatpp::provider::ResourceHandle<Resource>(nullptr));
+      }
+
+    };
+
+    return GetCoroutine::startForResult();
+  }
+
+  void stop() override {
+    OATPP_LOGD("EmptyProvider", "stop()")
+  }
+
+};
 
 struct AcquisitionProxy : public oatpp::provider::AcquisitionProxy<Resource, AcquisitionProxy> {
 
@@ -169,6 +198,18 @@ void clientMethod(std::shared_ptr<TestPool> pool, bool invalidate) {
   }
 }
 
+void shardedClientMethod(std::shared_ptr<TestPool> pool, v_int64 maxResources, v_int32 iterations, std::atomic<bool>* overflow) {
+  for(v_int32 i = 0; i < iterations; i ++) {
+    auto resource = pool->get();
+    if(resource.object == nullptr || pool->getCounter() > maxResources) {
+      *overflow = true;
+    }
+    if(i % 100 == 0) {
+      resource.invalidator->invalidate(resource.object);
+    }
+  }
+}
+
 }
 
 void PoolTest::onRun() {
@@ -222,6 +263,146 @@ void PoolTest::onRun() {
 
   pool->stop();
 
+  OATPP_LOGD(TAG, "Run 3 - LIFO order")
+  {
+    auto lifoProvider = std::make_shared<TestProvider>();
+    auto lifoPool = TestPool::createShared(lifoProvider, 3, std::chrono::seconds(10));
+
+    auto r1 = lifoPool->get();
+    auto r2 = lifoPool->get();
+    auto r3 = lifoPool->get();
+    auto id2 = r2.object->myId();
+
+    r1 = nullptr;
+    r3 = nullptr;
+    r2 = nullptr;
+
+    auto r = lifoPool->get();
+    OATPP_ASSERT(r.object->myId() == id2)
+    OATPP_ASSERT(lifoProvider->getIdCounter() == 3)
+    r = nullptr;
+
+    lifoPool->stop();
+  }
+
+  OATPP_LOGD(TAG, "Run 4 - acquisition proxies are recycled")
+  {
+    auto recycleProvider = std::make_shared<TestProvider>();
+    auto recyclePool = TestPool::createShared(recycleProvider, 1, std::chrono::seconds(10));
+
+    recyclePool->get(); // warm up
+    auto statsBefore = oatpp::async::utils::FrameAllocator::getStats();
+    for(v_int32 i = 0; i < 10000; i ++) {
+      auto r = recyclePool->get();
+      OATPP_ASSERT(r.object != nullptr)
+    }
+    auto statsAfter = oatpp::async::utils::FrameAllocator::getStats();
+
+    OATPP_LOGD(TAG, "heap allocations for 10000 acquisitions: %ld", statsAfter.heapAllocations - statsBefore.heapAllocations)
+    OATPP_ASSERT(statsAfter.heapAllocations == statsBefore.heapAllocations)
+
+    recyclePool->stop();
+  }
+
+  OATPP_LOGD(TAG, "Run 5 - sharded pool")
+  {
+    const v_int64 maxResources = 4;
+    const v_int32 threadsCount = 16;
+    const v_int32 iterations = 2000;
+
+    auto shardedProvider = std::make_shared<TestProvider>();
+    auto shardedPool = TestPool::createShared(shardedProvider, maxResources, std::chrono::seconds(10),
+                                              std::chrono::microseconds::zero(), 8 /* shards */);
+
+    std::atomic<bool> overflow(false);
+    std::list<std::thread> shardedThreads;
+
+    for(v_int32 i = 0; i < threadsCount; i ++) {
+      shardedThreads.push_back(std::thread(shardedClientMethod, shardedPool, maxResources, iterations, &overflow));
+    }
+    for(v_int32 i = 0; i < 100; i ++) {
+      executor.execute<ClientCoroutine>(shardedPool, i % 10 == 0);
+    }
+
+    for(std::thread& thread : shardedThreads) {
+      thread.join();
+    }
+    executor.waitTasksFinished();
+
+    OATPP_LOGD(TAG, "sharded pool counter=%ld, resources created=%ld", shardedPool->getCounter(), shardedProvider->getIdCounter())
+    OATPP_ASSERT(!overflow)
+    OATPP_ASSERT(shardedPool->getCounter() <= maxResources)
+    OATPP_ASSERT(shardedPool->getCounter() > 0)
+
+    shardedPool->stop();
+    OATPP_ASSERT(shardedPool->getCounter() == 0)
+  }
+
+  OATPP_LOGD(TAG, "Run 6 - pre-warming and TTL eviction")
+  {
+    auto warmExecutor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+    auto warmProvider = std::make_shared<TestProvider>();
+    auto warmPool = TestPool::createShared(warmProvider, 10, std::chrono::milliseconds(300));
+
+    /* pool is warmed up right away - before any request */
+    warmPool->setMinIdle(3, warmExecutor);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    OATPP_LOGD(TAG, "warmed up: counter=%ld, idle=%ld", warmPool->getCounter(), warmPool->getIdleCount())
+    OATPP_ASSERT(warmPool->getCounter() == 3)
+    OATPP_ASSERT(warmPool->getIdleCount() == 3)
+
+    /* taken resource is replaced ahead of the next request */
+    auto r1 = warmPool->get();
+    auto r2 = warmPool->get();
+    OATPP_ASSERT(warmProvider->getIdCounter() <= 5)
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    OATPP_LOGD(TAG, "after get: counter=%ld, idle=%ld", warmPool->getCounter(), warmPool->getIdleCount())
+    OATPP_ASSERT(warmPool->getCounter() == 5)
+    OATPP_ASSERT(warmPool->getIdleCount() == 3)
+
+    /* TTL eviction keeps minIdle resources */
+    r1 = nullptr;
+    r2 = nullptr;
+    OATPP_ASSERT(warmPool->getIdleCount() == 5)
+    std::this_thread::sleep_for(std::chrono::milliseconds(800));
+    OATPP_LOGD(TAG, "after TTL: counter=%ld, idle=%ld", warmPool->getCounter(), warmPool->getIdleCount())
+    OATPP_ASSERT(warmPool->getCounter() == 3)
+    OATPP_ASSERT(warmPool->getIdleCount() == 3)
+
+    /* pre-warming is limited by maxResources */
+    warmPool->setMinIdle(20, warmExecutor);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    OATPP_ASSERT(warmPool->getCounter() == 10)
+
+    warmPool->stop();
+    OATPP_ASSERT(warmPool->getCounter() == 0)
+
+    warmExecutor->waitTasksFinished();
+    warmExecutor->stop();
+    warmExecutor->join();
+  }
+
+  OATPP_LOGD(TAG, "Run 7 - pre-warming with provider returning empty resources")
+  {
+    auto warmExecutor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+    auto emptyPool = TestPool::createShared(std::make_shared<EmptyProvider>(), 10, std::chrono::milliseconds(300));
+
+    /* reservations of empty resources are released - nothing gets to the bench */
+    emptyPool->setMinIdle(3, warmExecutor);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    OATPP_LOGD(TAG, "empty warm-up: counter=%ld, idle=%ld", emptyPool->getCounter(), emptyPool->getIdleCount())
+    OATPP_ASSERT(emptyPool->getIdleCount() == 0)
+
+    emptyPool->setMinIdle(0, warmExecutor);
+    warmExecutor->waitTasksFinished();
+    OATPP_ASSERT(emptyPool->getCounter() == 0)
+
+    emptyPool->stop();
+
+    warmExecutor->stop();
+    warmExecutor->join();
+  }
+
   executor.stop();
   executor.join();
 
@@ -0,0 +1,76 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "SchedulerTest.hpp"
+
+#include "oatpp/provider/Scheduler.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace provider {
+
+void SchedulerTest::onRun() {
+
+  auto tasksBefore = Scheduler::getTasksCount();
+
+  std::shared_ptr<std::atomic<v_int64>> fastRuns = std::make_shared<std::atomic<v_int64>>(0);
+  std::shared_ptr<std::atomic<v_int64>> slowRuns = std::make_shared<std::atomic<v_int64>>(0);
+  std::shared_ptr<std::atomic<v_int64>> onceRuns = std::make_shared<std::atomic<v_int64>>(0);
+  std::shared_ptr<std::atomic<bool>> stop = std::make_shared<std::atomic<bool>>(false);
+
+  Scheduler::schedule(std::chrono::milliseconds(10), [fastRuns, stop]() {
+    ++ (*fastRuns);
+    return !stop->load();
+  });
+
+  Scheduler::schedule(std::chrono::milliseconds(100), [slowRuns, stop]() {
+    ++ (*slowRuns);
+    return !stop->load();
+  });
+
+  Scheduler::schedule(std::chrono::milliseconds(10), [onceRuns]() {
+    ++ (*onceRuns);
+    return false;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(550));
+  stop->store(true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  OATPP_LOGD(TAG, "fast=%ld, slow=%ld, once=%ld", fastRuns->load(), slowRuns->load(), onceRuns->load())
+
+  OATPP_ASSERT(onceRuns->load() == 1)
+  OATPP_ASSERT(slowRuns->load() >= 3 && slowRuns->load() <= 8)
+  OATPP_ASSERT(fastRuns->load() > slowRuns->load() * 3)
+
+  /* tasks which returned false are removed */
+  auto fastRunsStopped = fastRuns->load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  OATPP_ASSERT(fastRuns->load() == fastRunsStopped)
+  OATPP_ASSERT(Scheduler::getTasksCount() <= tasksBefore)
+
+}
+
+}}
@@ -0,0 +1,421 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ClientPipelineTest.hpp"
+
+#include "oatpp/web/app/Controller.hpp"
+
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+
+#include "oatpp/json/ObjectMapper.hpp"
+
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/Interface.hpp"
+
+#include "oatpp/macro/component.hpp"
+
+#include "oatpp-test/web/ClientServerTestRunner.hpp"
+
+namespace oatpp { namespace test { namespace web {
+
+namespace {
+
+typedef oatpp::web::client::HttpRequestExecutor HttpRequestExecutor;
+typedef oatpp::web::client::RequestExecutor::RequestExecutionError RequestExecutionError;
+
+class TestComponent {
+private:
+  v_uint16 m_port;
+public:
+
+  TestComponent(v_uint16 port)
+    : m_port(port)
+  {}
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
+    return oatpp::network::virtual_::Interface::obtainShared("virtualhost");
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, serverConnectionProvider)([this] {
+
+    if(m_port == 0) { // Use oatpp virtual interface
+      OATPP_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, _interface);
+      return std::static_pointer_cast<oatpp::network::ServerConnectionProvider>(
+        oatpp::network::virtual_::server::ConnectionProvider::createShared(_interface)
+      );
+    }
+
+    return std::static_pointer_cast<oatpp::network::ServerConnectionProvider>(
+      oatpp::network::tcp::server::ConnectionProvider::createShared({"localhost", m_port})
+    );
+
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ClientConnectionProvider>, clientConnectionProvider)([this] {
+
+    if(m_port == 0) {
+      OATPP_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, _interface);
+      return std::static_pointer_cast<oatpp::network::ClientConnectionProvider>(
+        oatpp::network::virtual_::client::ConnectionProvider::createShared(_interface)
+      );
+    }
+
+    return std::static_pointer_cast<oatpp::network::ClientConnectionProvider>(
+      oatpp::network::tcp::client::ConnectionProvider::createShared({"localhost", m_port})
+    );
+
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, httpRouter)([] {
+    return oatpp::web::server::HttpRouter::createShared();
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([] {
+    OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
+    return oatpp::web::server::HttpConnectionHandler::createShared(router);
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::data::mapping::ObjectMapper>, objectMapper)([] {
+    return std::make_shared<oatpp::json::ObjectMapper>();
+  }());
+
+};
+
+/*
+ * Mix of content-length, chunked, and request-body exchanges.
+ */
+static constexpr v_buff_size OVERSIZED_BODY_LIMIT = 256;
+
+/*
+ * Echo exchanges - the second response body is larger than `OVERSIZED_BODY_LIMIT`.
+ */
+std::vector<HttpRequestExecutor::PipelinedRequest> createOversizedRequests() {
+  std::vector<HttpRequestExecutor::PipelinedRequest> requests(3);
+  for(auto& request : requests) {
+    request.method = "POST";
+    request.path = "echo";
+    request.body = oatpp::web::protocol::http::outgoing::BufferBody::createShared("short");
+  }
+  requests[1].body = oatpp::web::protocol::http::outgoing::BufferBody::createShared(oatpp::String(std::string(1024, 'a')));
+  return requests;
+}
+
+void checkOversizedResponses(const std::vector<HttpRequestExecutor::PipelinedResponse>& responses) {
+  OATPP_ASSERT(responses.size() == 3)
+  OATPP_ASSERT(responses[0].errorCode == 0)
+  OATPP_ASSERT(responses[0].response->readBodyToString() == "short")
+  OATPP_ASSERT(responses[1].response.get() == nullptr)
+  OATPP_ASSERT(responses[1].errorCode == RequestExecutionError::ERROR_CODE_CANT_READ_RESPONSE)
+  OATPP_ASSERT(responses[2].response.get() == nullptr)
+  OATPP_ASSERT(responses[2].errorCode == RequestExecutionError::ERROR_CODE_NO_RESPONSE)
+}
+
+std::vector<HttpRequestExecutor::PipelinedRequest> createRequests(v_int32 count) {
+
+  std::vector<HttpRequestExecutor::PipelinedRequest> requests;
+
+  for(v_int32 i = 0; i < count; i ++) {
+
+    HttpRequestExecutor::PipelinedRequest request;
+
+    switch(i % 3) {
+      case 0:
+        request.method = "GET";
+        request.path = "params/" + oatpp::utils::Conversion::int32ToStr(i);
+        break;
+      case 1:
+        request.method = "POST";
+        request.path = "echo";
+        request.body = oatpp::web::protocol::http::outgoing::BufferBody::createShared("echo-" + oatpp::utils::Conversion::int32ToStr(i));
+        break;
+      default:
+        request.method = "GET";
+        request.path = "chunked/word" + oatpp::utils::Conversion::int32ToStr(i) + "/" + oatpp::utils::Conversion::int32ToStr(i % 7 + 1);
+        break;
+    }
+
+    requests.push_back(request);
+
+  }
+
+  return requests;
+
+}
+
+void checkResponses(const std::vector<HttpRequestExecutor::PipelinedResponse>& responses,
+                    const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper)
+{
+
+  for(size_t index = 0; index < responses.size(); index ++) {
+
+    auto i = static_cast<v_int32>(index);
+    const auto& pr = responses[index];
+
+    OATPP_ASSERT(pr.errorCode == 0)
+    OATPP_ASSERT(pr.response)
+    OATPP_ASSERT(pr.response->getStatusCode() == 200)
+
+    switch(i % 3) {
+      case 0: {
+        auto dto = pr.response->readBodyToDto<oatpp::Object<app::TestDto>>(objectMapper.get());
+        OATPP_ASSERT(dto)
+        OATPP_ASSERT(dto->testValue == oatpp::utils::Conversion::int32ToStr(i))
+        break;
+      }
+      case 1: {
+        auto body = pr.response->readBodyToString();
+        OATPP_ASSERT(body == "echo-" + oatpp::utils::Conversion::int32ToStr(i))
+        break;
+      }
+      default: {
+        oatpp::String word = "word" + oatpp::utils::Conversion::int32ToStr(i);
+        oatpp::data::stream::BufferOutputStream expected;
+        for(v_int32 j = 0; j < i % 7 + 1; j ++) {
+          expected << word;
+        }
+        auto body = pr.response->readBodyToString();
+        OATPP_ASSERT(body == expected.toString())
+        break;
+      }
+    }
+
+  }
+
+}
+
+class PipelineCoroutine : public oatpp::async::Coroutine<PipelineCoroutine> {
+private:
+  std::shared_ptr<HttpRequestExecutor> m_executor;
+  std::vector<HttpRequestExecutor::PipelinedRequest> m_requests;
+  v_int32 m_maxInFlight;
+  v_buff_size m_maxBodySize;
+  bool m_invalidateConnection;
+  std::vector<HttpRequestExecutor::PipelinedResponse>* m_result;
+public:
+
+  PipelineCoroutine(const std::shared_ptr<HttpRequestExecutor>& executor,
+                    const std::vector<HttpRequestExecutor::PipelinedRequest>& requests,
+                    v_int32 maxInFlight,
+                    std::vector<HttpRequestExecutor::PipelinedResponse>* result,
+                    v_buff_size maxBodySize = 4 * 1024 * 1024,
+                    bool invalidateConnection = false)
+    : m_executor(executor)
+    , m_requests(requests)
+    , m_maxInFlight(maxInFlight)
+    , m_maxBodySize(maxBodySize)
+    , m_invalidateConnection(invalidateConnection)
+    , m_result(result)
+  {}
+
+  Action act() override {
+    return m_executor->getConnectionAsync().callbackTo(&PipelineCoroutine::onConnection);
+  }
+
+  Action onConnection(const std::shared_ptr<HttpRequestExecutor::ConnectionHandle>& connectionHandle) {
+    if(m_invalidateConnection) {
+      m_executor->invalidateConnection(connectionHandle);
+    }
+    return m_executor->executePipelinedAsync(m_requests, connectionHandle, m_maxInFlight, m_maxBodySize)
+      .callbackTo(&PipelineCoroutine::onResponses);
+  }
+
+  Action onResponses(const std::vector<HttpRequestExecutor::PipelinedResponse>& responses) {
+    *m_result = responses;
+    return finish();
+  }
+
+};
+
+}
+
+void ClientPipelineTest::onRun() {
+
+  TestComponent component(m_port);
+
+  oatpp::test::web::ClientServerTestRunner runner;
+
+  runner.addController(app::Controller::createShared());
+
+  runner.run([this] {
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::network::ClientConnectionProvider>, connectionProvider);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::data::mapping::ObjectMapper>, objectMapper);
+
+    auto requestExecutor = HttpRequestExecutor::createShared(connectionProvider);
+    auto requests = createRequests(m_iterationsPerStep);
+
+    {
+      OATPP_LOGI(TAG, "Test: sync pipeline")
+      auto connection = requestExecutor->getConnection();
+      auto responses = requestExecutor->executePipelined(requests, connection, 4);
+      OATPP_ASSERT(responses.size() == requests.size())
+      checkResponses(responses, objectMapper);
+
+      OATPP_LOGI(TAG, "Test: connection is reusable after pipeline")
+      auto response = requestExecutor->executeOnce("GET", "/", {}, nullptr, connection);
+      OATPP_ASSERT(response->getStatusCode() == 200)
+      OATPP_ASSERT(response->readBodyToString() == "Hello World!!!")
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: sync pipeline, maxInFlight=1")
+      auto connection = requestExecutor->getConnection();
+      auto responses = requestExecutor->executePipelined(requests, connection, 1);
+      OATPP_ASSERT(responses.size() == requests.size())
+      checkResponses(responses, objectMapper);
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: sync pipeline, maxInFlight > requests count")
+      auto connection = requestExecutor->getConnection();
+      auto responses = requestExecutor->executePipelined(requests, connection, m_iterationsPerStep * 2);
+      OATPP_ASSERT(responses.size() == requests.size())
+      checkResponses(responses, objectMapper);
+    }
+
+    /* over tcp, requests unread by the closing server may reset the connection before the last response arrives */
+    if(m_port == 0) {
+      OATPP_LOGI(TAG, "Test: server closes connection in the middle of pipeline")
+
+      std::vector<HttpRequestExecutor::PipelinedRequest> closingRequests = createRequests(6);
+      closingRequests[2].headers.put("Connection", "close");
+
+      auto connection = requestExecutor->getConnection();
+      auto responses = requestExecutor->executePipelined(closingRequests, connection, 4);
+      OATPP_ASSERT(responses.size() == closingRequests.size())
+
+      std::vector<HttpRequestExecutor::PipelinedResponse> answered(responses.begin(), responses.begin() + 3);
+      checkResponses(answered, objectMapper);
+
+      for(size_t i = 3; i < responses.size(); i ++) {
+        OATPP_ASSERT(responses[i].response.get() == nullptr)
+        OATPP_ASSERT(responses[i].errorCode == RequestExecutionError::ERROR_CODE_NO_RESPONSE)
+        OATPP_ASSERT(responses[i].errorMessage)
+      }
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: response body over the limit")
+      auto connection = requestExecutor->getConnection();
+      auto responses = requestExecutor->executePipelined(createOversizedRequests(), connection, 4, OVERSIZED_BODY_LIMIT);
+      checkOversizedResponses(responses);
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: send to invalidated connection")
+      auto connection = requestExecutor->getConnection();
+      requestExecutor->invalidateConnection(connection);
+      auto responses = requestExecutor->executePipelined(requests, connection, 4);
+      OATPP_ASSERT(responses.size() == requests.size())
+      for(const auto& pr : responses) {
+        OATPP_ASSERT(pr.response.get() == nullptr)
+        OATPP_ASSERT(pr.errorCode == RequestExecutionError::ERROR_CODE_NO_RESPONSE)
+      }
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: empty pipeline")
+      auto connection = requestExecutor->getConnection();
+      auto responses = requestExecutor->executePipelined({}, connection);
+      OATPP_ASSERT(responses.empty())
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: null connection")
+      bool thrown = false;
+      try {
+        requestExecutor->executePipelined(requests, nullptr);
+      } catch (const RequestExecutionError& e) {
+        OATPP_ASSERT(e.getErrorCode() == RequestExecutionError::ERROR_CODE_CANT_CONNECT)
+        thrown = true;
+      }
+      OATPP_ASSERT(thrown)
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: async pipeline")
+
+      oatpp::async::Executor executor(1, 1, 1);
+
+      std::vector<HttpRequestExecutor::PipelinedResponse> responses;
+      executor.execute<PipelineCoroutine>(requestExecutor, requests, 4, &responses);
+
+      executor.waitTasksFinished();
+      executor.stop();
+      executor.join();
+
+      OATPP_ASSERT(responses.size() == requests.size())
+      checkResponses(responses, objectMapper);
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: async pipeline, response body over the limit")
+
+      oatpp::async::Executor executor(1, 1, 1);
+
+      std::vector<HttpRequestExecutor::PipelinedResponse> responses;
+      executor.execute<PipelineCoroutine>(requestExecutor, createOversizedRequests(), 4, &responses, OVERSIZED_BODY_LIMIT);
+
+      executor.waitTasksFinished();
+      executor.stop();
+      executor.join();
+
+      checkOversizedResponses(responses);
+    }
+
+    {
+      OATPP_LOGI(TAG, "Test: async pipeline, send to invalidated connection")
+
+      oatpp::async::Executor executor(1, 1, 1);
+
+      std::vector<HttpRequestExecutor::PipelinedResponse> responses;
+      executor.execute<PipelineCoroutine>(requestExecutor, requests, 4, &responses, 4 * 1024 * 1024, true);
+
+      executor.waitTasksFinished();
+      executor.stop();
+      executor.join();
+
+      OATPP_ASSERT(responses.size() == requests.size())
+      for(const auto& pr : responses) {
+        OATPP_ASSERT(pr.response.get() == nullptr)
+        OATPP_ASSERT(pr.errorCode == RequestExecutionError::ERROR_CODE_NO_RESPONSE)
+      }
+    }
+
+  }, std::chrono::minutes(10));
+
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+
+}
+
+}}}
@@ -26,6 +26,7 @@
 #define oatpp_test_web_FullAsyncTest_hpp
 
 #include "oatpp-test/UnitTest.hpp"
+#include "oatpp/async/Executor.hpp"
 
 namespace oatpp { namespace test { namespace web {
   
@@ -33,12 +34,14 @@ class FullAsyncTest : public UnitTest {
 private:
   v_uint16 m_port;
   v_int32 m_iterationsPerStep;
+  v_int32 m_ioWorkerType;
 public:
   
-  FullAsyncTest(v_uint16 port, v_int32 iterationsPerStep)
+  FullAsyncTest(v_uint16 port, v_int32 iterationsPerStep, v_int32 ioWorkerType = oatpp::async::Executor::VALUE_SUGGESTED)
     : UnitTest("TEST[web::FullAsyncTest]")
     , m_port(port)
     , m_iterationsPerStep(iterationsPerStep)
+    , m_ioWorkerType(ioWorkerType)
   {}
 
   void onRun() override;
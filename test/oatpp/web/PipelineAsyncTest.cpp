@@ -29,6 +29,8 @@
 #include "oatpp/web/server/AsyncHttpConnectionHandler.hpp"
 #include "oatpp/web/server/HttpRouter.hpp"
 
+#include "oatpp/async/utils/FrameAllocator.hpp"
+
 #include "oatpp/json/ObjectMapper.hpp"
 
 #include "oatpp/network/tcp/server/ConnectionProvider.hpp"
@@ -141,6 +143,8 @@ void PipelineAsyncTest::onRun() {
     auto connection = clientConnectionProvider->get();
     connection.object->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
 
+    auto statsBefore = oatpp::async::utils::FrameAllocator::getStats();
+
     std::thread pipeInThread([this, connection] {
 
       oatpp::data::stream::BufferOutputStream pipelineStream;
@@ -175,6 +179,11 @@ void PipelineAsyncTest::onRun() {
     pipeOutThread.join();
     pipeInThread.join();
 
+    auto statsAfter = oatpp::async::utils::FrameAllocator::getStats();
+    OATPP_LOGD(TAG, "coroutine frames per request: allocations=%.2f, heap allocations=%.2f",
+               static_cast<v_float64>(statsAfter.allocations - statsBefore.allocations) / m_pipelineSize,
+               static_cast<v_float64>(statsAfter.heapAllocations - statsBefore.heapAllocations) / m_pipelineSize)
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////////
     // Stop server and unblock accepting thread
 
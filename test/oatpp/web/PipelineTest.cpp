@@ -50,10 +50,12 @@ namespace {
 class TestComponent {
 private:
   v_uint16 m_port;
+  v_int32 m_threadPoolSize;
 public:
 
-  TestComponent(v_uint16 port)
+  TestComponent(v_uint16 port, v_int32 threadPoolSize)
     : m_port(port)
+    , m_threadPoolSize(threadPoolSize)
   {}
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
@@ -79,8 +81,11 @@ public:
     return oatpp::web::server::HttpRouter::createShared();
   }());
 
-  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([] {
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([this] {
     OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
+    if(m_threadPoolSize > 0) {
+      return oatpp::web::server::HttpConnectionHandler::createShared(router, m_threadPoolSize);
+    }
     return oatpp::web::server::HttpConnectionHandler::createShared(router);
   }());
 
@@ -123,7 +128,7 @@ const char* const SAMPLE_OUT =
 
 void PipelineTest::onRun() {
 
-  TestComponent component(m_port);
+  TestComponent component(m_port, m_threadPoolSize);
 
   oatpp::test::web::ClientServerTestRunner runner;
 
@@ -133,6 +138,16 @@ void PipelineTest::onRun() {
 
     OATPP_COMPONENT(std::shared_ptr<oatpp::network::ClientConnectionProvider>, clientConnectionProvider);
 
+    /* clients stalled in the middle of request headers must not hold pool threads */
+    oatpp::String partialRequest = "GET / HTTP/1.1\r\nHost: localhost\r\n";
+    std::list<provider::ResourceHandle<data::stream::IOStream>> stalledConnections;
+    for(v_int32 i = 0; i < m_threadPoolSize; i ++) {
+      auto stalled = clientConnectionProvider->get();
+      stalled.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+      stalled.object->writeExactSizeDataSimple(partialRequest->data(), static_cast<v_buff_size>(partialRequest->size()));
+      stalledConnections.push_back(stalled);
+    }
+
     auto connection = clientConnectionProvider->get();
     connection.object->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
 
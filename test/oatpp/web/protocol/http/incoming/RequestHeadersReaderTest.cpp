@@ -0,0 +1,303 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RequestHeadersReaderTest.hpp"
+
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReader.hpp"
+#include "oatpp/utils/parser/ByteScanner.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+#include "oatpp/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace incoming {
+
+namespace {
+
+typedef oatpp::web::protocol::http::Headers Headers;
+typedef oatpp::web::protocol::http::RequestStartingLine RequestStartingLine;
+typedef oatpp::web::protocol::http::Status Status;
+typedef oatpp::web::protocol::http::Parser Parser;
+typedef oatpp::web::protocol::http::HttpError HttpError;
+typedef oatpp::web::protocol::http::Header Header;
+
+typedef oatpp::utils::parser::ByteScanner ByteScanner;
+typedef oatpp::web::protocol::http::incoming::RequestHeadersReader RequestHeadersReader;
+
+const char* const REQUEST =
+  "GET /api/v1/users/42?fields=name,email HTTP/1.1\r\n"
+  "Host: localhost:8000\r\n"
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0 Safari/537.36\r\n"
+  "Accept: application/json, text/plain, */*\r\n"
+  "Accept-Encoding: gzip, deflate, br\r\n"
+  "Accept-Language: en-US,en;q=0.9\r\n"
+  "Cache-Control: no-cache\r\n"
+  "Connection: keep-alive\r\n"
+  "Cookie: session=8f14e45fceea167a5a36dedd4bea2543; theme=dark\r\n"
+  "\r\n"
+  "body";
+
+const v_int32 NUM_HEADERS = 8;
+
+v_buff_size referenceFind(const char* data, v_buff_size size, const char* pattern, v_buff_size patternSize) {
+  for(v_buff_size i = 0; i + patternSize <= size; i ++) {
+    if(std::memcmp(data + i, pattern, static_cast<size_t>(patternSize)) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * Byte-at-a-time scan and parse - what RequestHeadersReader did before.
+ */
+v_buff_size legacyParse(const char* data, v_buff_size size, Headers& headers) {
+
+  const v_uint32 sectionEnd = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
+  v_uint32 accumulator = 0;
+  v_buff_size headersSize = -1;
+  for(v_buff_size i = 0; i < size; i ++) {
+    accumulator <<= 8;
+    accumulator |= static_cast<v_uint8>(data[i]);
+    if(accumulator == sectionEnd) {
+      headersSize = i + 1;
+      break;
+    }
+  }
+
+  oatpp::utils::parser::Caret caret(data, headersSize);
+  RequestStartingLine line;
+  Status status;
+  Parser::parseRequestStartingLine(line, nullptr, caret, status);
+  while (!caret.isAtRN()) {
+    Parser::parseOneHeader(headers, nullptr, caret, status);
+  }
+  caret.skipRN();
+
+  return headersSize;
+
+}
+
+v_buff_size vectorizedParse(const char* data, v_buff_size size, Headers& headers) {
+  auto headersSize = ByteScanner::findRNRN(data, size) + 4;
+  oatpp::utils::parser::Caret caret(data, headersSize);
+  RequestStartingLine line;
+  Status status;
+  Parser::parseRequestStartingLine(line, nullptr, caret, status);
+  Parser::parseHeaders(headers, nullptr, caret, status);
+  return headersSize;
+}
+
+}
+
+void RequestHeadersReaderTest::onRun() {
+
+  {
+    OATPP_LOGI(TAG, "ByteScanner vs reference...")
+
+    std::string buffer(300, 'x');
+    const char* patterns[] = {"\r\n\r\n", "\r\n", ":"};
+
+    for(size_t pos = 0; pos < 200; pos ++) {
+      for(v_buff_size p = 0; p < 3; p ++) {
+
+        std::string data = buffer;
+        auto patternSize = static_cast<v_buff_size>(std::strlen(patterns[p]));
+        data.replace(pos, static_cast<size_t>(patternSize), patterns[p]);
+        /* decoys which must not match */
+        if(pos > 4) {
+          data[pos - 3] = '\r';
+        }
+
+        for(v_buff_size offset = 0; offset < 3; offset ++) {
+          auto ptr = data.data() + offset;
+          auto size = static_cast<v_buff_size>(data.size()) - offset;
+          auto expected = referenceFind(ptr, size, patterns[p], patternSize);
+          v_buff_size result;
+          if(p == 0) {
+            result = ByteScanner::findRNRN(ptr, size);
+          } else if(p == 1) {
+            result = ByteScanner::findRN(ptr, size);
+          } else {
+            result = ByteScanner::findCharFromPair(ptr, size, ':', ';');
+          }
+          OATPP_ASSERT(result == expected)
+        }
+
+      }
+    }
+
+    OATPP_ASSERT(ByteScanner::findRNRN(buffer.data(), static_cast<v_buff_size>(buffer.size())) == -1)
+    OATPP_ASSERT(ByteScanner::findRNRN("\r\n\r", 3) == -1)
+    OATPP_ASSERT(ByteScanner::findCharFromPair("", 0, ':', ' ') == -1)
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Headers section split across chunks...")
+
+    for(v_buff_size chunkSize = 1; chunkSize < 12; chunkSize ++) {
+
+      auto inputStream = std::make_shared<data::stream::BufferInputStream>(oatpp::String(REQUEST));
+      v_char8 proxyBuffer[64];
+      data::stream::InputStreamBufferedProxy stream(inputStream, data::share::MemoryLabel(nullptr, proxyBuffer, 64), 0, 0, false);
+
+      data::stream::BufferOutputStream headersBuffer(2048);
+      RequestHeadersReader reader(&headersBuffer, chunkSize, 4096);
+
+      HttpError::Info error;
+      auto result = reader.readHeaders(&stream, error);
+
+      OATPP_ASSERT(error.ioStatus > 0)
+      OATPP_ASSERT(result.startingLine.method == "GET")
+      OATPP_ASSERT(result.startingLine.path == "/api/v1/users/42?fields=name,email")
+      OATPP_ASSERT(result.headers.getSize() == NUM_HEADERS)
+      OATPP_ASSERT(result.headers.get("host") == "localhost:8000")
+      OATPP_ASSERT(result.headers.get("Cookie") == "session=8f14e45fceea167a5a36dedd4bea2543; theme=dark")
+
+      /* only headers are consumed */
+      v_char8 body[16];
+      auto res = stream.readSimple(body, 16);
+      OATPP_ASSERT(res == 4 && std::memcmp(body, "body", 4) == 0)
+
+    }
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Well-known headers...")
+
+    const char* data =
+      "content-length: 10\r\n"
+      "X-Custom: custom\r\n"
+      "CONNECTION: close\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n";
+
+    oatpp::utils::parser::Caret caret(data);
+    Headers headers;
+    Status status;
+    Parser::parseHeaders(headers, nullptr, caret, status);
+
+    OATPP_ASSERT(status.code == 0)
+    OATPP_ASSERT(headers.getSize() == 4)
+    OATPP_ASSERT(headers.get(Header::Id::CONTENT_LENGTH) == "10")
+    OATPP_ASSERT(headers.get(Header::CONTENT_LENGTH) == "10")
+    OATPP_ASSERT(headers.get(Header::Id::CONNECTION) == "close")
+    OATPP_ASSERT(headers.get("connection") == "close")
+    OATPP_ASSERT(headers.get("x-custom") == "custom")
+    OATPP_ASSERT(headers.get(Header::Id::HOST) == nullptr)
+    OATPP_ASSERT(headers.get(Header::HOST) == nullptr)
+
+    OATPP_ASSERT(headers.putIfNotExists(Header::Id::CONNECTION, "upgrade") == false)
+    OATPP_ASSERT(headers.putOrReplace("Connection", "upgrade") == true)
+    OATPP_ASSERT(headers.getSize() == 3)
+    OATPP_ASSERT(headers.get(Header::Id::CONNECTION) == "upgrade")
+    OATPP_ASSERT(headers.get(Header::Id::CONTENT_LENGTH) == "10")
+
+    OATPP_ASSERT(headers.putIfNotExists(Header::Id::SERVER, Header::Value::SERVER) == true)
+    OATPP_ASSERT(headers.get("server") == Header::Value::SERVER)
+
+    v_int32 count = 0;
+    for(auto& pair : headers.getAll_Unsafe()) {
+      if(pair.first == Header::SERVER) {
+        count ++;
+      }
+    }
+    OATPP_ASSERT(count == 1)
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Tab as optional whitespace...")
+
+    const char* data =
+      "Content-Length:\t10\r\n"
+      "Connection: \t close\r\n"
+      "\r\n";
+
+    oatpp::utils::parser::Caret caret(data);
+    Headers headers;
+    Status status;
+    Parser::parseHeaders(headers, nullptr, caret, status);
+
+    OATPP_ASSERT(status.code == 0)
+    OATPP_ASSERT(headers.getSize() == 2)
+    OATPP_ASSERT(headers.get(Header::Id::CONTENT_LENGTH) == "10")
+    OATPP_ASSERT(headers.get(Header::Id::CONNECTION) == "close")
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Malformed headers...")
+
+    const char* data = "Host localhost\r\n\r\n";
+    oatpp::utils::parser::Caret caret(data);
+    Headers headers;
+    Status status;
+    Parser::parseHeaders(headers, nullptr, caret, status);
+    OATPP_ASSERT(status == Status::CODE_400)
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    const v_int32 iterations = 200000;
+    auto size = static_cast<v_buff_size>(std::strlen(REQUEST));
+
+    v_int64 legacyTime;
+    v_int64 vectorizedTime;
+
+    {
+      oatpp::test::PerformanceChecker checker("Legacy scan and parse");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        Headers headers;
+        OATPP_ASSERT(legacyParse(REQUEST, size, headers) == size - 4)
+        OATPP_ASSERT(headers.getSize() == NUM_HEADERS)
+      }
+      legacyTime = checker.getElapsedTicks();
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("Vectorized scan and parse");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        Headers headers;
+        OATPP_ASSERT(vectorizedParse(REQUEST, size, headers) == size - 4)
+        OATPP_ASSERT(headers.getSize() == NUM_HEADERS)
+      }
+      vectorizedTime = checker.getElapsedTicks();
+    }
+
+    OATPP_LOGD(TAG, "per request: legacy=%ldns, vectorized=%ldns",
+               legacyTime * 1000 / iterations, vectorizedTime * 1000 / iterations)
+  }
+
+}
+
+}}}}}}
@@ -0,0 +1,223 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "FileBodyTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/FileBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+
+#include "oatpp/data/resource/TemporaryFile.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+#include "oatpp/async/Executor.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::FileBody FileBody;
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+typedef oatpp::web::protocol::http::Status Status;
+typedef oatpp::web::protocol::http::Range Range;
+
+const v_buff_size FILE_SIZE = 256 * 1024;
+
+class SendCoroutine : public oatpp::async::Coroutine<SendCoroutine> {
+private:
+  std::shared_ptr<Response> m_response;
+  std::shared_ptr<data::stream::OutputStream> m_stream;
+  std::shared_ptr<data::stream::BufferOutputStream> m_headersBuffer;
+public:
+
+  SendCoroutine(const std::shared_ptr<Response>& response, const std::shared_ptr<data::stream::OutputStream>& stream)
+    : m_response(response)
+    , m_stream(stream)
+    , m_headersBuffer(std::make_shared<data::stream::BufferOutputStream>(2048))
+  {}
+
+  Action act() override {
+    return Response::sendAsync(m_response, m_stream, m_headersBuffer, nullptr).next(finish());
+  }
+
+};
+
+/**
+ * Send response over loopback TCP connection and return everything received by the client.
+ */
+oatpp::String sendOverLoopback(const std::shared_ptr<Response>& response, bool async) {
+
+  typedef oatpp::network::tcp::server::ConnectionProvider ServerProvider;
+  typedef oatpp::network::tcp::client::ConnectionProvider ClientProvider;
+
+  auto serverProvider = ServerProvider::createShared({"127.0.0.1", 0, oatpp::network::Address::IP_4});
+  auto port = static_cast<v_uint16>(std::stoi(*serverProvider->getProperty(ServerProvider::PROPERTY_PORT).toString()));
+  auto clientProvider = ClientProvider::createShared({"127.0.0.1", port, oatpp::network::Address::IP_4});
+
+  auto clientConnection = clientProvider->get();
+  OATPP_ASSERT(clientConnection.object)
+
+  oatpp::String received;
+  std::thread reader([&clientConnection, &received]{
+    data::stream::BufferOutputStream stream;
+    v_char8 buffer[4096];
+    v_io_size res;
+    while((res = clientConnection.object->readSimple(buffer, 4096)) > 0) {
+      stream.writeSimple(buffer, res);
+    }
+    received = stream.toString();
+  });
+
+  {
+    auto serverConnection = serverProvider->get();
+    OATPP_ASSERT(serverConnection.object)
+
+#ifdef OATPP_NETWORK_TCP_SENDFILE
+    OATPP_ASSERT(FileBody::isZeroCopySupported(serverConnection.object.get()))
+#endif
+
+    if(async) {
+      oatpp::async::Executor executor(1, 1, 1);
+      serverConnection.object->setOutputStreamIOMode(data::stream::IOMode::ASYNCHRONOUS);
+      executor.execute<SendCoroutine>(response, serverConnection.object);
+      executor.waitTasksFinished();
+      executor.stop();
+      executor.join();
+    } else {
+      data::stream::BufferOutputStream headersBuffer(2048);
+      response->send(serverConnection.object.get(), &headersBuffer, nullptr);
+    }
+  }
+
+  reader.join();
+  serverProvider->stop();
+
+  return received;
+
+}
+
+void checkResponse(const oatpp::String& received, const oatpp::String& fileData,
+                   v_int64 start, v_int64 end, const char* expectedHeader)
+{
+  auto headersEnd = received->find("\r\n\r\n");
+  OATPP_ASSERT(headersEnd != std::string::npos)
+  auto headers = received->substr(0, headersEnd);
+  auto body = received->substr(headersEnd + 4);
+  OATPP_ASSERT(headers.find(expectedHeader) != std::string::npos)
+  OATPP_ASSERT(body == fileData->substr(static_cast<size_t>(start), static_cast<size_t>(end - start + 1)))
+}
+
+}
+
+void FileBodyTest::onRun() {
+
+  data::resource::TemporaryFile tmpFile(".");
+
+  std::string data(static_cast<size_t>(FILE_SIZE), '\0');
+  for(v_buff_size i = 0; i < FILE_SIZE; i ++) {
+    data[static_cast<size_t>(i)] = static_cast<char>('a' + (i * 7) % 26);
+  }
+  oatpp::String fileData(std::move(data));
+
+  {
+    auto stream = tmpFile.openOutputStream();
+    stream->writeExactSizeDataSimple(fileData->data(), static_cast<v_buff_size>(fileData->size()));
+  }
+
+  data::resource::File file(tmpFile.getLocation());
+
+  for(v_int32 i = 0; i < 2; i ++) {
+
+    bool async = i > 0;
+    OATPP_LOGI(TAG, "Mode: %s", async ? "async" : "sync")
+
+    {
+      OATPP_LOGI(TAG, "Whole file...")
+      auto response = Response::createShared(Status::CODE_200, FileBody::createShared(file, "text/plain"));
+      auto received = sendOverLoopback(response, async);
+      checkResponse(received, fileData, 0, FILE_SIZE - 1, "Content-Length: 262144");
+      OATPP_LOGI(TAG, "OK")
+    }
+
+    {
+      OATPP_LOGI(TAG, "Range...")
+      auto range = Range::parse("bytes=1000-1999");
+      auto response = Response::createShared(Status::CODE_206, FileBody::createShared(file, range));
+      auto received = sendOverLoopback(response, async);
+      checkResponse(received, fileData, 1000, 1999, "Content-Range: bytes 1000-1999/262144");
+      OATPP_LOGI(TAG, "OK")
+    }
+
+    {
+      OATPP_LOGI(TAG, "Open-ended range...")
+      auto range = Range::parse("bytes=262000-");
+      auto response = Response::createShared(Status::CODE_206, FileBody::createShared(file, range));
+      auto received = sendOverLoopback(response, async);
+      checkResponse(received, fileData, 262000, FILE_SIZE - 1, "Content-Length: 144");
+      OATPP_LOGI(TAG, "OK")
+    }
+
+    {
+      OATPP_LOGI(TAG, "Suffix range...")
+      auto range = Range::parse("bytes=-100");
+      auto response = Response::createShared(Status::CODE_206, FileBody::createShared(file, range));
+      auto received = sendOverLoopback(response, async);
+      checkResponse(received, fileData, FILE_SIZE - 100, FILE_SIZE - 1, "Content-Range: bytes 262044-262143/262144");
+      OATPP_LOGI(TAG, "OK")
+    }
+
+  }
+
+  {
+    OATPP_LOGI(TAG, "Fallback for non-socket stream...")
+    auto range = Range::parse("bytes=5000-");
+    auto response = Response::createShared(Status::CODE_206, FileBody::createShared(file, range));
+    OATPP_ASSERT(!FileBody::isZeroCopySupported(nullptr))
+    data::stream::BufferOutputStream stream;
+    data::stream::BufferOutputStream headersBuffer(2048);
+    response->send(&stream, &headersBuffer, nullptr);
+    checkResponse(stream.toString(), fileData, 5000, FILE_SIZE - 1, "Content-Range: bytes 5000-262143/262144");
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Range not satisfiable...")
+    bool thrown = false;
+    try {
+      FileBody::createShared(file, Range::parse("bytes=262144-"));
+    } catch (oatpp::web::protocol::http::HttpError& e) {
+      thrown = true;
+      OATPP_ASSERT(e.getInfo().status == Status::CODE_416)
+    }
+    OATPP_ASSERT(thrown)
+    OATPP_LOGI(TAG, "OK")
+  }
+
+}
+
+}}}}}}
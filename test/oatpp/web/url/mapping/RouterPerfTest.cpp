@@ -0,0 +1,130 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RouterPerfTest.hpp"
+
+#include "oatpp/web/url/mapping/Router.hpp"
+#include "oatpp/utils/Conversion.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace url { namespace mapping {
+
+namespace {
+
+typedef oatpp::web::url::mapping::Pattern Pattern;
+typedef oatpp::web::url::mapping::Router<v_int32> NumRouter;
+
+/*
+ * Router as it was before radix tree - match patterns one by one.
+ */
+class LinearRouter {
+private:
+  std::vector<std::pair<std::shared_ptr<Pattern>, v_int32>> m_patterns;
+public:
+
+  void route(const oatpp::String& pathPattern, v_int32 endpoint) {
+    m_patterns.push_back({Pattern::parse(pathPattern), endpoint});
+  }
+
+  v_int32 getRoute(const oatpp::data::share::StringKeyLabel& path, Pattern::MatchMap& result) {
+    for(auto& pair : m_patterns) {
+      Pattern::MatchMap matchMap;
+      if(pair.first->match(path, matchMap)) {
+        result = matchMap;
+        return pair.second;
+      }
+    }
+    return -1;
+  }
+
+};
+
+}
+
+void RouterPerfTest::onRun() {
+
+  const v_int32 numResources = 100;
+  const v_int32 numIterations = 10000;
+
+  LinearRouter linearRouter;
+  NumRouter router;
+
+  v_int32 endpoint = 0;
+  for(v_int32 i = 0; i < numResources; i ++) {
+    oatpp::String resource = "api/resource" + utils::Conversion::int32ToStr(i);
+    for(auto suffix : {"", "/{id}", "/{id}/items", "/{id}/items/{itemId}"}) {
+      oatpp::String pattern = resource + suffix;
+      linearRouter.route(pattern, endpoint);
+      router.route(pattern, endpoint);
+      endpoint ++;
+    }
+  }
+
+  OATPP_LOGD(TAG, "Endpoints count: %d", endpoint)
+
+  const char* const paths[] = {
+    "api/resource0",
+    "api/resource50/10/items",
+    "api/resource99/10/items/20?q=1",
+    "api/unknown/10"
+  };
+
+  for(auto path : paths) {
+    Pattern::MatchMap linearMap;
+    auto linearEndpoint = linearRouter.getRoute(path, linearMap);
+    auto route = router.getRoute(path);
+    OATPP_ASSERT(linearEndpoint == (route ? route.getEndpoint() : -1))
+    if(route) {
+      OATPP_ASSERT(route.getMatchMap().getVariables().size() == linearMap.getVariables().size())
+      OATPP_ASSERT(route.getMatchMap().getTail() == linearMap.getTail())
+    }
+  }
+
+  for(auto path : paths) {
+
+    OATPP_LOGD(TAG, "path='%s'", path)
+    oatpp::data::share::StringKeyLabel pathLabel(path);
+
+    {
+      oatpp::test::PerformanceChecker checker("Linear Router");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        Pattern::MatchMap matchMap;
+        linearRouter.getRoute(pathLabel, matchMap);
+      }
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("Radix Tree Router");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        router.getRoute(pathLabel);
+      }
+    }
+
+  }
+
+}
+
+}}}}}
@@ -0,0 +1,217 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RouterTest.hpp"
+
+#include "oatpp/web/url/mapping/Router.hpp"
+#include "oatpp/utils/Conversion.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace url { namespace mapping {
+
+namespace {
+
+typedef oatpp::web::url::mapping::Pattern Pattern;
+typedef oatpp::web::url::mapping::Router<v_int32> NumRouter;
+
+/*
+ * Resolve path the way it was done before radix tree - match patterns one by one.
+ */
+v_int32 matchLinear(const std::vector<std::shared_ptr<Pattern>>& patterns, const oatpp::String& path, Pattern::MatchMap& matchMap) {
+  for(size_t i = 0; i < patterns.size(); i ++) {
+    Pattern::MatchMap map;
+    if(patterns[i]->match(path, map)) {
+      matchMap = map;
+      return static_cast<v_int32>(i);
+    }
+  }
+  return -1;
+}
+
+void checkPath(const std::vector<std::shared_ptr<Pattern>>& patterns, NumRouter& router, const oatpp::String& path) {
+
+  Pattern::MatchMap expectedMap;
+  auto expected = matchLinear(patterns, path, expectedMap);
+
+  auto route = router.getRoute(path);
+
+  OATPP_LOGD("RouterTest", "path='%s' -> %d", path->c_str(), expected)
+
+  if(expected < 0) {
+    OATPP_ASSERT(!route)
+    return;
+  }
+
+  OATPP_ASSERT(route)
+  OATPP_ASSERT(route.getEndpoint() == expected)
+
+  const auto& expectedVariables = expectedMap.getVariables();
+  OATPP_ASSERT(route.getMatchMap().getVariables().size() == expectedVariables.size())
+  for(auto& pair : expectedVariables) {
+    OATPP_ASSERT(route.getMatchMap().getVariable(pair.first) == pair.second.toString())
+  }
+
+  OATPP_ASSERT(route.getMatchMap().getTail() == expectedMap.getTail())
+
+}
+
+}
+
+void RouterTest::onRun() {
+
+  const char* const patternStrings[] = {
+    "/",
+    "users",
+    "users/{id}",
+    "users/me",
+    "users/{id}/posts",
+    "users/{userId}/posts/{postId}",
+    "users/{id}/*",
+    "files/*",
+    "files/static/{name}",
+    "a?b/c",
+    "search?",
+    "ints/{value}",
+    "ints/1",
+    "api/v1/{}/items",
+    "api/*",
+    "dup/{x}/{x}",
+    "many/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}/{i}/{j}",
+    "*"
+  };
+
+  const char* const paths[] = {
+    "", "/", "//", "?", "/?q",
+    "users", "/users/", "users/?x", "users/10", "users/me", "users//10//posts",
+    "users/10/posts", "users/10/posts/20", "users/10/posts/20/x", "users/10/posts/?x", "users/10/posts?x",
+    "users/10?x=1", "users/me?x=1", "users/10?x=1/posts", "users/10?x=1/posts/20",
+    "files", "files/", "files/a/b/c", "files/static/x", "files/static/x?y",
+    "a?b/c", "a?b", "a", "a?c",
+    "search", "search?", "search?q",
+    "ints/1", "ints/2", "ints/1?x",
+    "api/v1/x/items", "api/v1/x/items?q", "api/v1//items", "api/v2",
+    "dup/1/2", "many/1/2/3/4/5/6/7/8/9/10", "many/1/2/3/4/5/6/7/8/9/10?q", "many/1/2/3",
+    "unknown/path"
+  };
+
+  {
+    OATPP_LOGI(TAG, "Same routes as linear match...")
+
+    std::vector<std::shared_ptr<Pattern>> patterns;
+    NumRouter router;
+
+    for(auto patternString : patternStrings) {
+      router.route(patternString, static_cast<v_int32>(patterns.size()));
+      patterns.push_back(Pattern::parse(patternString));
+    }
+
+    for(auto path : paths) {
+      checkPath(patterns, router, path);
+    }
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Same routes as linear match (reversed order)...")
+
+    std::vector<std::shared_ptr<Pattern>> patterns;
+    NumRouter router;
+
+    for(v_int32 i = sizeof(patternStrings) / sizeof(patternStrings[0]) - 1; i >= 0; i --) {
+      router.route(patternStrings[i], static_cast<v_int32>(patterns.size()));
+      patterns.push_back(Pattern::parse(patternStrings[i]));
+    }
+
+    for(auto path : paths) {
+      checkPath(patterns, router, path);
+    }
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "Variables...")
+
+    Pattern::MatchMap::Variables variables;
+    OATPP_ASSERT(variables.empty())
+
+    for(v_int32 i = 0; i < 20; i ++) {
+      variables.put("v" + utils::Conversion::int32ToStr(i), utils::Conversion::int32ToStr(i));
+    }
+    variables.put("v0", "zero");
+
+    OATPP_ASSERT(variables.size() == 20)
+    OATPP_ASSERT(variables.find("v0")->second == "zero")
+    OATPP_ASSERT(variables.find("v19")->second == "19")
+    OATPP_ASSERT(variables.find("v20") == variables.end())
+
+    Pattern::MatchMap::Variables copy = variables;
+    variables.clear();
+    OATPP_ASSERT(variables.empty())
+    OATPP_ASSERT(variables.find("v0") == variables.end())
+    OATPP_ASSERT(copy.size() == 20)
+    OATPP_ASSERT(copy.find("v7")->second == "7")
+    OATPP_ASSERT(copy.at("v19") == "19")
+    OATPP_ASSERT(copy.count("v20") == 0)
+
+    Pattern::MatchMap::Variables moved = std::move(copy);
+    OATPP_ASSERT(copy.empty())
+    OATPP_ASSERT(moved.size() == 20)
+    OATPP_ASSERT(moved.find("v0")->second == "zero")
+
+    Pattern::MatchMap::Variables small;
+    small.put("a", "1");
+    small.put("b", "2");
+    moved = std::move(small);
+    OATPP_ASSERT(small.empty())
+    OATPP_ASSERT(moved.size() == 2)
+    OATPP_ASSERT(moved.at("b") == "2")
+    OATPP_ASSERT(moved.count("v0") == 0)
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGI(TAG, "First added route wins...")
+
+    NumRouter router;
+    router.route("users/{id}", 1);
+    router.route("users/me", 2);
+    router.route("users/me", 3);
+
+    auto route = router.getRoute("users/me");
+    OATPP_ASSERT(route && route.getEndpoint() == 1)
+    OATPP_ASSERT(route.getMatchMap().getVariable("id") == "me")
+
+    auto matchMap = route.takeMatchMap();
+    OATPP_ASSERT(matchMap.getVariable("id") == "me")
+    OATPP_ASSERT(route.getMatchMap().getVariables().empty())
+
+    OATPP_LOGI(TAG, "OK")
+  }
+
+}
+
+}}}}}